@@ -0,0 +1,1072 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "BaselineRun.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include <map>
+#include "CompleteCache.h"
+#include "FixedCache.h"
+#include "Coalesce.h"
+#include "ShardedLru.h"
+#include "StackDistanceLru.h"
+#include "OptimalCache.h"
+#include "NextUse.h"
+#include "Snapshot.h"
+#include "TimeSampler.h"
+#include "TraceReader.h"
+
+#define TILE_COUNT_LOG2 0
+#define COHERENCE_UNIT_LOG2 6
+#define PREFETCH_DISTANCE 16 //queries whose sets are being loaded ahead of the current one
+#define SAMPLE_GROUPS 32 //the sampled sets are split into this many groups, whose spread gives the confidence intervals
+#define SAMPLE_T_QUANTILE 2.040 //two-sided 95% quantile of Student's t with SAMPLE_GROUPS - 1 degrees of freedom
+
+#define LINE_WIDTH 48
+#define PRINT_VERSION cout << "rev" << BASELINE_VERSION << endl
+#define PRINT_MULT(char, count) (cout << setfill(char) << setw(count) << "")
+
+using namespace std;
+
+enum AccessType {READ, WRITE, FETCH, EVICT_CLEAN, EVICT_DIRTY, EVICT_WRTIABLE, UPGRADE};
+
+static time_t start;
+static TraceReader* trace;
+static ofstream out;
+static long double timer;
+static long double clkStep;
+static Coalesce* coalesce;
+static map<lli, unsigned int> countExact2WBs;
+static int blockOffset, setCount, indexSize, setCount_log2;
+static int sampleShift; //1 in 2^sampleShift sets is simulated
+
+/**
+ * Statistics of one group of sampled sets
+ */
+struct SampleGroup {
+    lli writeBacks;
+    lli readHits;
+    lli totalReadAccess;
+};
+
+static SampleGroup sampleGroups[SAMPLE_GROUPS];
+static TimeSampler* timeSampler; //nullptr unless time sampling
+static ofstream telemetry; //open if the displacement telemetry is written
+static LogHistogram sampledDisplacements, sampledEvictionAges; //of the cuckoo section at the previous sample of the telemetry
+
+//percentiles of the displacements and of the eviction ages, in the report and in the telemetry alike
+static const double tailPercentiles[] = {0.5, 0.9, 0.99, 0.999};
+static const char* tailPercentileNames[] = {"50", "90", "99", "99.9"};
+static const int tailPercentileCount = sizeof(tailPercentiles) / sizeof(tailPercentiles[0]);
+
+static void preReport(const RunConfig& config);
+static void postReport(const CompleteCache& l2AndCuckoo);
+static void lruReport(const Cache& lru);
+static void lruReport(lli hits, lli misses, lli writeBacks, lli readHits, lli totalReadAccess, size_t writeBackLogSize);
+static void analysisReport(const RunConfig& config);
+static void timeSamplingReport();
+static void printWriteBackMargin();
+static void printReadHitRatioMargin();
+
+/**
+ * Open the time trace and the trace, print the constants and compute the geometry of the cache
+ */
+static void setUp(const RunConfig& config) {
+    
+    if (!config.timeTracePath.empty()) {
+        out.open(config.timeTracePath);
+        
+        if (!out.is_open()) {
+            cout << "Specified File Cannot Be Opened\n";
+            exit(EXIT_FAILURE);
+        }
+        
+        clkStep = config.clkStep;
+    }
+    
+    //the trace is read from config.tracePath if given, and from stdin otherwise or when a sweep streams it there
+    trace = openTrace(config.traceSource());
+    preReport(config);
+    start = time(NULL);
+    int maxBlockOffsetNum = (config.blockBytes / 4) - 1;
+    int maxIndex = (int) ((((lli) config.cacheKiB * 1024) / config.blockBytes) / config.associativity) - 1; //caches of 2 GiB and more overflow an int
+    blockOffset = 0;
+    setCount = maxIndex + 1;
+    indexSize = 0;
+    setCount_log2 = log2(setCount);
+    
+    while (maxBlockOffsetNum != 0) {
+        blockOffset++;
+        maxBlockOffsetNum = maxBlockOffsetNum >> 1;
+    }
+    
+    while (maxIndex != 0) {
+        indexSize++;
+        maxIndex = maxIndex >> 1;
+    }
+    
+    sampleShift = log2(config.sampleSets);
+    
+    if (config.sampleSets > 1) {
+        
+        if ( ((config.sampleSets & (config.sampleSets - 1)) != 0) || ((setCount >> sampleShift) < SAMPLE_GROUPS) ) {
+            cout << "Sampled Sets Must Be A Power Of Two And Leave At Least " << SAMPLE_GROUPS << " Sets\n";
+            exit(EXIT_FAILURE);
+        }
+        
+        if ( config.coalesce || config.countExact2WBs || !config.timeTracePath.empty() || (config.threads > 1) || !config.checkpointPath.empty() || !config.restorePath.empty() ) {
+            cout << "Set Sampling Cannot Be Combined With The Analyses, The Time Trace, Threads Or Snapshots\n";
+            exit(EXIT_FAILURE);
+        }
+        
+        //the model holds only the sampled sets (see sample())
+        setCount >>= sampleShift;
+        indexSize -= sampleShift;
+        setCount_log2 -= sampleShift;
+    }
+    
+    if (config.sampleLength != 0) {
+        
+        if ( config.coalesce || config.countExact2WBs || !config.timeTracePath.empty() || (config.threads > 1) || !config.checkpointPath.empty() || !config.restorePath.empty() || (config.sampleSets > 1) ) {
+            cout << "Time Sampling Cannot Be Combined With The Analyses, The Time Trace, Threads, Snapshots Or Set Sampling\n";
+            exit(EXIT_FAILURE);
+        }
+        
+        timeSampler = new TimeSampler(config);
+    }
+    
+    if (config.coalesce) {
+        coalesce = new Coalesce;
+    }
+    
+}
+
+static void printTimeTraceBanner(const RunConfig& config) {
+    
+    if (!config.timeTracePath.empty()) {
+        timer = 0;
+        PRINT_MULT('-', LINE_WIDTH / 2 - 11);
+        cout << " GENERATE TIME TRACE ";
+        PRINT_MULT('-', LINE_WIDTH / 2 - 10);
+        cout << endl;
+    }
+    
+}
+
+static void printSamplingBanner(const RunConfig& config) {
+    
+    if (config.sampleSets > 1) {
+        PRINT_MULT('-', LINE_WIDTH / 2 - 7);
+        cout << " SET SAMPLING ";
+        PRINT_MULT('-', LINE_WIDTH / 2 - 7);
+        cout << endl;
+        cout << "1 IN " << config.sampleSets << " SETS (" << setCount << " SETS IN " << SAMPLE_GROUPS << " GROUPS)" << endl;
+    }
+    
+}
+
+static void printAnalysisBanners(const RunConfig& config) {
+    
+    if (config.coalesce) {
+        PRINT_MULT('-', LINE_WIDTH / 2 - 5);
+        cout << " COALESCE ";
+        PRINT_MULT('-', LINE_WIDTH / 2 - 5);
+        cout << endl;
+    }
+    
+    if (config.countExact2WBs) {
+        PRINT_MULT('-', LINE_WIDTH / 2 - 9);
+        cout << " COUNT_EXACT2WBS ";
+        PRINT_MULT('-', LINE_WIDTH / 2 - 8);
+        cout << endl;
+    }
+    
+}
+
+/**
+ * Send a query to an LRU cache; without Detailed, the query only warms the cache up and its value is dropped
+ * @return The outcome in the form ICD reports it; evictedContent is meaningful only on a dirty eviction
+ */
+template<bool Detailed, class LruCache>
+static inline QueryRet send(LruCache& lru, lli addr, bool dirty, bool affectReadHitRatio, const BlockValue& value) {
+    auto ret = Detailed ? lru.request(addr, dirty, affectReadHitRatio, value) : lru.warm(addr, dirty, affectReadHitRatio);
+    QueryRet result;
+    result.hit = ret.first;
+    result.dirtyEviction = (!ret.first) && ret.second.dirty;
+    result.evictedContent = ret.second.content;
+    return result;
+}
+
+template<bool Detailed>
+static inline QueryRet send(CompleteCache& l2AndCuckoo, lli addr, bool dirty, bool affectReadHitRatio, const BlockValue& value) {
+    return Detailed ? l2AndCuckoo.query(addr, dirty, affectReadHitRatio, value) : l2AndCuckoo.warm(addr, dirty, affectReadHitRatio);
+}
+
+/**
+ * Decide whether an address maps to one of the sampled sets, those whose low sampleShift index bits are 0, and squeeze
+ * these bits out of it, so that the sampled sets map one to one onto a model with 2^sampleShift times fewer sets.
+ * The whole address is kept otherwise, so that its tag still tells it apart from the others.
+ * An ICD model built that way has as many times fewer cuckoo rows too: the full cache is taken as 2^sampleShift
+ * independent slices, each with its share of the sets and a cuckoo row group of its own, and one of them is simulated.
+ * As the cuckoo rows are spread uniformly over the addresses, a row group sees the same displacement pressure as the
+ * shared region, though blocks no longer displace across slices
+ * @return False if the address maps to a set that is not sampled
+ */
+static inline bool sample(uint64_t& addr) {
+    int bitsBeforeIndex = blockOffset + 2;
+    
+    if (((addr >> bitsBeforeIndex) & ((1LL << sampleShift) - 1)) != 0) {
+        return false;
+    }
+    
+    addr = ((addr >> (bitsBeforeIndex + sampleShift)) << bitsBeforeIndex) | (addr & ((1LL << bitsBeforeIndex) - 1));
+    return true;
+}
+
+/**
+ * Read the next query of the trace; with Sampled, the queries to the sets that are not sampled are skipped
+ * @return False if the trace is exhausted
+ */
+template<bool Sampled>
+static inline bool nextQuery(TraceRecord& record) {
+    
+    while (trace->next(record)) {
+        
+        if ( (record.type != TRACE_UPGRADE) && (!Sampled || sample(record.addr)) ) { //ignore Upgrade
+            return true;
+        }
+        
+    }
+    
+    return false;
+}
+
+/**
+ * Write a row of the displacement telemetry; only ICD has one
+ */
+template<class Model>
+static void sampleTelemetry(const Model&, lli) {
+    
+}
+
+/**
+ * Write the columns of the telemetry for the tail of a histogram: its tailPercentiles, then its maximum
+ */
+static void writeTail(const LogHistogram& histogram) {
+    
+    for (int i = 0; i < tailPercentileCount; i++) {
+        telemetry << "," << histogram.percentile(tailPercentiles[i]);
+    }
+    
+    telemetry << "," << histogram.getMax();
+}
+
+/**
+ * Write a row of the displacement telemetry: the load of the cuckoo ways, and the displacements and the evictions since
+ * the previous row; the counts of a set sampling run are scaled up to the whole cache
+ * @param queries Number of queries simulated so far
+ */
+static void sampleTelemetry(const CompleteCache& l2AndCuckoo, lli queries) {
+    const Cuckoo& cuckoo = l2AndCuckoo.getComponentCuckoo();
+    lli scale = 1LL << sampleShift;
+    LogHistogram displacements = cuckoo.displacements;
+    LogHistogram evictionAges = cuckoo.evictionAges;
+    displacements.subtract(sampledDisplacements);
+    evictionAges.subtract(sampledEvictionAges);
+    sampledDisplacements = cuckoo.displacements;
+    sampledEvictionAges = cuckoo.evictionAges;
+    lli occupancy = 0;
+    
+    for (int i = 0; i < cuckoo.associativity; i++) {
+        occupancy += cuckoo.getOccupancy(i);
+    }
+    
+    telemetry << queries << "," << 1.0 * occupancy / ((lli) cuckoo.rowCount * cuckoo.associativity);
+    
+    for (int i = 0; i < cuckoo.associativity; i++) {
+        telemetry << "," << 1.0 * cuckoo.getOccupancy(i) / cuckoo.rowCount;
+    }
+    
+    telemetry << "," << scale * displacements.getTotal();
+    writeTail(displacements);
+    telemetry << "," << scale * evictionAges.getTotal();
+    writeTail(evictionAges);
+    telemetry << "\n";
+}
+
+/**
+ * Save the model and the state of the analyses to config.checkpointPath
+ * @param queries Number of queries simulated so far
+ */
+template<class Model>
+static void saveState(const Model& model, const RunConfig& config, lli queries) {
+    SnapshotWriter snapshot(config.checkpointPath, config, queries);
+    snapshot.put8(config.coalesce);
+    snapshot.put8(config.countExact2WBs);
+    snapshot.putRaw(&timer, sizeof(timer));
+    model.save(snapshot);
+    
+    if (config.coalesce) {
+        coalesce->save(snapshot);
+    }
+    
+    if (config.countExact2WBs) {
+        snapshot.put64(countExact2WBs.size());
+        
+        for (auto it = countExact2WBs.begin(); it != countExact2WBs.end(); it++) {
+            snapshot.put64(it->first);
+            snapshot.put32(it->second);
+        }
+        
+    }
+    
+    snapshot.close();
+}
+
+/**
+ * Load the model and the state of the analyses from config.restorePath and skip the queries already simulated
+ * @return Number of queries simulated before the snapshot
+ */
+template<class Model>
+static lli restoreState(Model& model, const RunConfig& config) {
+    SnapshotReader snapshot(config.restorePath, config);
+    
+    if ( (snapshot.get8() != config.coalesce) || (snapshot.get8() != config.countExact2WBs) ) {
+        cout << "Snapshot Does Not Match The Configuration\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    snapshot.getRaw(&timer, sizeof(timer));
+    model.load(snapshot);
+    
+    if (config.coalesce) {
+        coalesce->load(snapshot);
+    }
+    
+    if (config.countExact2WBs) {
+        lli mapSize = snapshot.get64();
+        
+        for (lli i = 0; i < mapSize; i++) {
+            lli blockID = snapshot.get64();
+            countExact2WBs[blockID] = snapshot.get32();
+        }
+        
+    }
+    
+    snapshot.close();
+    skipQueries(trace, snapshot.getQueryOffset());
+    return snapshot.getQueryOffset();
+}
+
+/**
+ * Feed the whole trace to the model; the analyses are template parameters so that the loop is compiled once per combination.
+ * The queries are read PREFETCH_DISTANCE ahead and their sets prefetched, so that the host memory misses of large
+ * models overlap; they are still sent one by one in trace order.
+ * With TimeSampled, the queries between the windows of timeSampler only warm the model up, and the trace is left
+ * unread once its estimates are precise enough
+ * @param restored Number of queries simulated before the snapshot the run resumes from
+ * @return Number of lines ignored at the end of the trace
+ */
+template<bool TimeTrace, bool DoCoalesce, bool CountExact2WBs, bool Sampled, bool TimeSampled, class Model>
+static lli replay(Model& model, const RunConfig& config, lli restored) {
+    TraceRecord window[PREFETCH_DISTANCE];
+    lli readCount = 0;
+    lli sentCount = 0; //below readCount if time sampling leaves the window unsent
+    bool more = true;
+    
+    //an exhausted trace is not read again, as that would reset its count of ignored lines
+    while ( (readCount < PREFETCH_DISTANCE) && (more = nextQuery<Sampled>(window[readCount])) ) {
+        model.prefetch(window[readCount].addr);
+        readCount++;
+    }
+    
+    for (lli sent = 0; sent < readCount; sent++) {
+        const TraceRecord& record = window[sent % PREFETCH_DISTANCE];
+        lli inp = record.addr;
+        AccessType newType = (AccessType) record.type; //TraceType follows the order of AccessType
+        const BlockValue& value = record.value;
+        
+        //send query
+        bool dirty = (newType == EVICT_DIRTY);
+        bool affectReadHitRatio = ((newType == READ) || (newType == WRITE) || (newType == FETCH));
+        QueryRet result = (!TimeSampled || timeSampler->detailed()) ? send<true>(model, inp, dirty, affectReadHitRatio, value) : send<false>(model, inp, dirty, affectReadHitRatio, value);
+        sentCount++;
+        
+        if (TimeSampled) {
+            timeSampler->advance(model.getWriteBackCount(), model.readHits, model.totalReadAccess);
+            
+            if (timeSampler->done()) {
+                break; //the rest of the trace is left unread
+            }
+            
+        }
+        
+        if (Sampled) {
+            //the groups interleave over the sampled sets, which are the sets of the model
+            SampleGroup& group = sampleGroups[(inp >> (blockOffset + 2)) & (SAMPLE_GROUPS - 1)];
+            group.writeBacks += result.dirtyEviction;
+            
+            if (affectReadHitRatio) {
+                group.totalReadAccess++;
+                group.readHits += result.hit;
+            }
+            
+        }
+        
+        //the write-backs of ICD are counted as well, where the former CUCKOO_RUN loop left the map empty
+        if (CountExact2WBs && result.dirtyEviction) {
+            lli blockID = result.evictedContent.addr >> (blockOffset + 2);
+            countExact2WBs[blockID]++;
+        }
+        
+        if (DoCoalesce && !result.hit) {
+            lli qCounter = model.getHitCount() + model.getMissCount() - 1;
+            lli blockAddr = inp >> (blockOffset + 2); // (block offset + byte offset)
+            
+            if (dirty) { //if missed (not in cache) and it is a write
+                coalesce->writeQuery(blockAddr, qCounter);
+            }
+            
+            if (result.dirtyEviction) { //dirty eviction
+                coalesce->dirtyEviction(result.evictedContent.addr >> (blockOffset + 2), qCounter);
+            }
+            
+        }
+        
+        if (TimeTrace) {
+            
+            if (!result.hit) {
+                //miss
+                out << inp << " R " << fixed << timer << " " << value << endl;
+            }
+            
+            if (result.dirtyEviction) {
+                out << result.evictedContent.addr << " W " << fixed << timer << " " << result.evictedContent.value << endl;
+            }
+            
+            if ( (newType == READ) || (newType == WRITE) ) {
+                timer += clkStep;
+            }
+            
+        }
+        
+        if ( (config.checkpointEvery != 0) && ((restored + sent + 1) % config.checkpointEvery == 0) ) {
+            saveState(model, config, restored + sent + 1);
+        }
+        
+        if ( (config.telemetryEvery != 0) && ((restored + sent + 1) % config.telemetryEvery == 0) ) {
+            sampleTelemetry(model, restored + sent + 1);
+        }
+        
+        //the slot of the query just sent takes the query PREFETCH_DISTANCE ahead
+        if ( more && (more = nextQuery<Sampled>(window[readCount % PREFETCH_DISTANCE])) ) {
+            model.prefetch(window[readCount % PREFETCH_DISTANCE].addr);
+            readCount++;
+        }
+        
+    }
+    
+    if (!config.checkpointPath.empty()) {
+        saveState(model, config, restored + sentCount);
+    }
+    
+    //the last row covers the queries after the last full period
+    if ( (config.telemetryEvery != 0) && ((restored + sentCount) % config.telemetryEvery != 0) ) {
+        sampleTelemetry(model, restored + sentCount);
+    }
+    
+    lli ignoreEnd = trace->getTrailingIgnored();
+    delete trace;
+    return ignoreEnd;
+}
+
+/**
+ * Pick the instance of replay() for the analyses of the configuration; done once, so nothing is dispatched per access
+ */
+template<class Model>
+static void simulate(Model& model, const RunConfig& config) {
+    int analyses = ((!config.timeTracePath.empty()) << 2) | (config.coalesce << 1) | config.countExact2WBs;
+    lli ignoreEnd = 0;
+    lli restored = config.restorePath.empty() ? 0 : restoreState(model, config);
+    
+    //a resumed run starts its telemetry with a row for the queries before the snapshot
+    if ( (config.telemetryEvery != 0) && (restored != 0) ) {
+        sampleTelemetry(model, restored);
+    }
+    
+    //set and time sampling run none of the analyses (see setUp())
+    switch ((sampleShift != 0) ? -1 : (timeSampler != nullptr) ? -2 : analyses) {
+        case -2: ignoreEnd = replay<false, false, false, false, true>(model, config, restored); break;
+        case -1: ignoreEnd = replay<false, false, false, true, false>(model, config, restored); break;
+        case 0: ignoreEnd = replay<false, false, false, false, false>(model, config, restored); break;
+        case 1: ignoreEnd = replay<false, false, true, false, false>(model, config, restored); break;
+        case 2: ignoreEnd = replay<false, true, false, false, false>(model, config, restored); break;
+        case 3: ignoreEnd = replay<false, true, true, false, false>(model, config, restored); break;
+        case 4: ignoreEnd = replay<true, false, false, false, false>(model, config, restored); break;
+        case 5: ignoreEnd = replay<true, false, true, false, false>(model, config, restored); break;
+        case 6: ignoreEnd = replay<true, true, false, false, false>(model, config, restored); break;
+        default: ignoreEnd = replay<true, true, true, false, false>(model, config, restored); break;
+    }
+    
+    cout << "(LAST " << ignoreEnd << " LINES WERE IGNORED)" << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl << endl;
+}
+
+template<class LruCache>
+static void runLruAs(const RunConfig& config) {
+    LruCache lru(setCount, config.associativity, blockOffset, indexSize);
+    printAnalysisBanners(config);
+    simulate(lru, config);
+    lruReport(lru);
+    timeSamplingReport();
+    analysisReport(config);
+}
+
+/**
+ * Simulate the LRU baseline on config.threads threads (see ShardedLru)
+ */
+static void runLruSharded(const RunConfig& config) {
+    ShardedLru lru(setCount, config.associativity, blockOffset, indexSize, config.threads, config.timeTracePath.empty() ? nullptr : &out, clkStep, config.countExact2WBs);
+    printAnalysisBanners(config);
+    lru.run(trace);
+    lli ignoreEnd = trace->getTrailingIgnored();
+    delete trace;
+    
+    cout << "(LAST " << ignoreEnd << " LINES WERE IGNORED)" << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl << endl;
+    
+    lruReport(lru.getHitCount(), lru.getMissCount(), lru.getWriteBackCount(), lru.getReadHits(), lru.getTotalReadAccess(), lru.getWriteBackLogSize());
+    
+    if (config.countExact2WBs) {
+        countExact2WBs = lru.getCountExact2WBs();
+    }
+    
+    analysisReport(config);
+}
+
+int runLru(const RunConfig& config) {
+    
+    if ( (config.threads > 1) && config.coalesce ) {
+        cout << "Coalesce Needs The Queries In Trace Order And Cannot Run On Several Threads\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    if ( (config.threads > 1) && (!config.checkpointPath.empty() || !config.restorePath.empty()) ) {
+        cout << "Snapshots Are Not Supported On Several Threads\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    setUp(config);
+    PRINT_MULT('-', LINE_WIDTH / 2 - 5);
+    cout << " LRU RUN ";
+    PRINT_MULT('-', LINE_WIDTH / 2 - 4);
+    cout << endl;
+    printTimeTraceBanner(config);
+    printSamplingBanner(config);
+    
+    //several threads share the sets among themselves; otherwise the standard geometries have a compile-time specialization (see FixedCache)
+    if (config.threads > 1) {
+        runLruSharded(config);
+    } else if (sampleShift != 0) {
+        runLruAs<Cache>(config);
+    } else if ( (config.cacheKiB == 512) && (config.associativity == 4) && (config.blockBytes == 64) ) {
+        runLruAs<CacheFor<512, 4, 64>::type>(config);
+    } else if ( (config.cacheKiB == 2048) && (config.associativity == 16) && (config.blockBytes == 64) ) {
+        runLruAs<CacheFor<2048, 16, 64>::type>(config);
+    } else if ( (config.cacheKiB == 8192) && (config.associativity == 16) && (config.blockBytes == 64) ) {
+        runLruAs<CacheFor<8192, 16, 64>::type>(config);
+    } else {
+        runLruAs<Cache>(config);
+    }
+    
+    return 0;
+}
+
+int runIcd(const RunConfig& config) {
+    setUp(config);
+    PRINT_MULT('-', LINE_WIDTH / 2 - 6);
+    cout << " CUCKOO RUN ";
+    PRINT_MULT('-', LINE_WIDTH / 2 - 6);
+    cout << endl;
+    printTimeTraceBanner(config);
+    printSamplingBanner(config);
+    CompleteCache* l2AndCuckoo = new CompleteCache(setCount, config.associativity - config.cuckooWayCount, setCount, setCount_log2, config.cuckooWayCount, blockOffset, config.threshold, indexSize, setCount_log2, TILE_COUNT_LOG2, COHERENCE_UNIT_LOG2, config.searchDepth);
+    
+    if (!config.telemetryPath.empty()) {
+        telemetry.open(config.telemetryPath);
+        
+        if (!telemetry.is_open()) {
+            cout << "Specified File Cannot Be Opened\n";
+            exit(EXIT_FAILURE);
+        }
+        
+        telemetry << "queries,load_factor";
+        
+        for (int i = 0; i < config.cuckooWayCount; i++) {
+            telemetry << ",occupancy_way_" << i;
+        }
+        
+        telemetry << ",insertions";
+        
+        for (int i = 0; i < tailPercentileCount; i++) {
+            telemetry << ",displacements_p" << tailPercentileNames[i];
+        }
+        
+        telemetry << ",displacements_max,evictions";
+        
+        for (int i = 0; i < tailPercentileCount; i++) {
+            telemetry << ",eviction_age_p" << tailPercentileNames[i];
+        }
+        
+        telemetry << ",eviction_age_max\n";
+    }
+    
+    printAnalysisBanners(config);
+    simulate(*l2AndCuckoo, config);
+    
+    cout << " ";
+    PRINT_MULT('-', 25);
+    cout << setfill(' ') << endl;
+    cout << "| Cuckoo Set Count: " << right << setw(5) << l2AndCuckoo->componentCuckoo.rowCount << " |\n";
+    cout << "| Cache Set Count:  " << right << setw(5) << l2AndCuckoo->componentNormal.rowCount << " |\n";
+    cout << "| Cuckoo Way Count: " << right << setw(5) << l2AndCuckoo->componentCuckoo.associativity << " |\n";
+    cout << "| Cache Way Count:  " << right << setw(5) << l2AndCuckoo->componentNormal.associativity << " |\n";
+    cout << "| Threshold:        " << right << setw(5) << config.threshold << " |\n";
+    
+    if (config.searchDepth != 0) {
+        cout << "| Search Depth:     " << right << setw(5) << config.searchDepth << " |\n";
+    }
+    
+    cout << " ";
+    PRINT_MULT('-', 25);
+    cout << endl;
+    postReport(*l2AndCuckoo);
+    timeSamplingReport();
+    cout << endl << endl;
+    analysisReport(config);
+    return 0;
+}
+
+int runLruSweep(const RunConfig& config) {
+    setUp(config);
+    PRINT_MULT('-', LINE_WIDTH / 2 - 6);
+    cout << " LRU SWEEP ";
+    PRINT_MULT('-', LINE_WIDTH / 2 - 5);
+    cout << endl;
+    
+    int levelCount = 1;
+    
+    while ((config.cacheKiB << levelCount) <= config.maxCacheKiB) {
+        levelCount++;
+    }
+    
+    if ((config.cacheKiB << (levelCount - 1)) != config.maxCacheKiB) {
+        cout << "Maximum Cache Size Must Be A Power-Of-Two Multiple Of Cache Size\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    StackDistanceLru sweep(setCount, levelCount, config.associativity, blockOffset);
+    TraceRecord record;
+    
+    while (trace->next(record)) {
+        
+        if (record.type == TRACE_UPGRADE) {
+            continue; //ignore Upgrade
+        }
+        
+        bool dirty = (record.type == TRACE_EVICT_DIRTY);
+        bool affectReadHitRatio = ((record.type == TRACE_READ) || (record.type == TRACE_WRITE) || (record.type == TRACE_FETCH));
+        sweep.request(record.addr, dirty, affectReadHitRatio);
+    }
+    
+    lli ignoreEnd = trace->getTrailingIgnored();
+    delete trace;
+    
+    cout << "(LAST " << ignoreEnd << " LINES WERE IGNORED)" << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl << endl;
+    
+    cout << "CACHE SIZE (KiB)\tSET COUNT\tHIT COUNT\tMISS COUNT\tMISS RATE\tREAD HIT COUNT\tTOTAL READ ACCESS COUNT\tWRITE BACK COUNT\tWRITEBACKLOG SIZE\n";
+    
+    for (int i = 0; i < levelCount; i++) {
+        lli hits = sweep.getHitCount(i);
+        lli misses = sweep.getMissCount(i);
+        cout << (config.cacheKiB << i) << "\t" << sweep.getSetCount(i) << "\t" << hits << "\t" << misses << "\t";
+        cout << fixed << setprecision(5) << 1.0 * misses / (hits + misses) << "\t";
+        cout << sweep.getReadHits(i) << "\t" << sweep.getTotalReadAccess(i) << "\t" << sweep.getWriteBackCount(i) << "\t" << sweep.getWriteBackLogSize(i) << endl;
+    }
+    
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+    time_t end = time(NULL);
+    time_t total = end - start;
+    cout << "TOTAL TIME: \t\t" << setfill('0') << setw(2) << total / 3600 << ":" << setw(2) << (total % 3600) / 60 << ":" << setw(2) << (total % 60) << endl;
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+    return 0;
+}
+
+/**
+ * Simulate an offline optimal cache; the next uses are found in a first pass over the trace, and the trace is
+ * opened again for the simulation
+ */
+static int runOptimal(const RunConfig& config, bool writeAware) {
+    
+    string source = config.traceSource();
+    
+    if ( source.empty() || (source == "-") ) {
+        cout << "The Oracle Reads The Trace Twice And Cannot Read It From Stdin\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    setUp(config);
+    PRINT_MULT('-', LINE_WIDTH / 2 - 5);
+    cout << (writeAware ? " OPT-WB RUN " : " OPT RUN ");
+    PRINT_MULT('-', LINE_WIDTH / 2 - (writeAware ? 7 : 4));
+    cout << endl;
+    
+    NextUse nextUse(trace, blockOffset + 2);
+    delete trace;
+    cout << "(" << nextUse.getQueryCount() << " QUERIES: NEXT USES FOUND)" << endl;
+    trace = openTrace(config.traceSource());
+    OptimalCache opt(setCount, config.associativity, blockOffset, indexSize, writeAware);
+    TraceRecord record;
+    
+    while (trace->next(record)) {
+        
+        if (record.type == TRACE_UPGRADE) {
+            continue; //ignore Upgrade
+        }
+        
+        bool dirty = (record.type == TRACE_EVICT_DIRTY);
+        bool affectReadHitRatio = ((record.type == TRACE_READ) || (record.type == TRACE_WRITE) || (record.type == TRACE_FETCH));
+        opt.request(record.addr, dirty, affectReadHitRatio, nextUse.next());
+    }
+    
+    lli ignoreEnd = trace->getTrailingIgnored();
+    delete trace;
+    
+    cout << "(LAST " << ignoreEnd << " LINES WERE IGNORED)" << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl << endl;
+    lruReport(opt);
+    return 0;
+}
+
+int runOpt(const RunConfig& config) {
+    return runOptimal(config, false);
+}
+
+int runOptWriteAware(const RunConfig& config) {
+    return runOptimal(config, true);
+}
+
+static void preReport(const RunConfig& config) {
+    PRINT_VERSION;
+    PRINT_MULT('=', LINE_WIDTH - 9);
+    cout << "CONSTANTS";
+    cout << endl;
+    cout << "Cache Size = \t\t" << config.cacheKiB << " (KiB)\n";
+    PRINT_MULT('_', LINE_WIDTH);
+    cout << endl;
+    cout << "Associativity = \t" << config.associativity << endl;
+    PRINT_MULT('_', LINE_WIDTH);
+    cout << endl;
+    cout << "Block Size = \t\t" << config.blockBytes << " (B)\n";
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl << endl;
+    PRINT_MULT('=', LINE_WIDTH - 5);
+    cout << "INPUT";
+    cout << endl;
+    size_t search = config.tracePath.find_last_of('/');
+    
+    if (search == string::npos) {
+        search = 0; //no slashes found; just print the whole thing!
+    } else {
+        search++;
+    }
+    cout << config.tracePath.substr(search) << endl;
+}
+
+/**
+ * Print the report of an LRU cache; the counts of a set sampling run are scaled up to the whole cache
+ */
+static void lruReport(const Cache& lru) {
+    lli scale = 1LL << sampleShift;
+    lruReport(scale * lru.getHitCount(), scale * lru.getMissCount(), scale * lru.getWriteBackCount(), scale * lru.readHits, scale * lru.totalReadAccess, scale * lru.writeBackLog.size());
+}
+
+static void lruReport(lli hits, lli misses, lli writeBacks, lli readHits, lli totalReadAccess, size_t writeBackLogSize) {
+    PRINT_MULT('_', LINE_WIDTH - 7 - 6);
+    cout << "NORMAL\n";
+    cout << "MISS RATE: \t\t" << fixed << setprecision(5) << 1.0 * misses / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * misses / (hits + misses) << "%" << endl;
+    cout << "HIT RATE: \t\t" << fixed << setprecision(5) << 1.0 * hits / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * hits / (hits + misses) << "%" <<  endl;
+    cout << "READ HIT COUNT: \t\t" << fixed << setprecision(5) << readHits << endl;
+    cout << "TOTAL READ ACCESS COUNT: \t\t" << totalReadAccess << endl;
+    cout << "READ HIT RATIO: \t\t" << fixed << setprecision(5) << 1.0 * readHits / totalReadAccess;
+    printReadHitRatioMargin();
+    cout << "WRITE BACK COUNT: \t" << writeBacks;
+    printWriteBackMargin();
+    cout << "WRITEBACKLOG SIZE: \t" << writeBackLogSize << endl;
+    cout << "NON RECURRING WRITEBACK COUNT: \t" << 1.0 * writeBackLogSize / writeBacks << endl;
+    cout << "TOTAL QUERIES: \t" << hits + misses << endl;
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+    time_t end = time(NULL);
+    time_t total = end - start;
+    cout << "TOTAL TIME: \t\t" << setfill('0') << setw(2) << total / 3600 << ":" << setw(2) << (total % 3600) / 60 << ":" << setw(2) << (total % 60) << endl;
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+}
+
+/**
+ * Print the estimates of time sampling; the report above counts every query simulated, measured or warming
+ */
+static void timeSamplingReport() {
+    
+    if (timeSampler != nullptr) {
+        timeSampler->print(cout);
+        PRINT_MULT('_', LINE_WIDTH - 7);
+        cout << endl;
+    }
+    
+}
+
+static void analysisReport(const RunConfig& config) {
+    
+    if (config.coalesce) {
+        cout << "COALESCE\n";
+        
+        for (int i = 0; i < coalesce->lt10s.size(); i++) {
+            cout << "ABS_LT(10^" << i + 1 << "): " << coalesce->lt10s.at(i) << endl;
+        }
+        
+        for (int i = 0; i < coalesce->lt2s.size(); i++) {
+            cout << "ABS_LT(2^" << i + 1 << "): " << coalesce->lt2s.at(i) << endl;
+        }
+        
+        cout << "ABS_TOTAL: " << coalesce->total << endl;
+        
+        for (int i = 0; i < coalesce->lt10s.size(); i++) {
+            cout << "REL_LT(10^" << i + 1 << "): " << 1.0 * coalesce->lt10s.at(i) / coalesce->total << endl;
+        }
+        
+        for (int i = 0; i < coalesce->lt2s.size(); i++) {
+            cout << "REL_LT(2^" << i + 1 << "): " << 1.0 * coalesce->lt2s.at(i) / coalesce->total << endl;
+        }
+        
+    }
+    
+    if (config.countExact2WBs) {
+        cout << "Count Exact 2 Write-Backs\n";
+        cout << "map size: " << countExact2WBs.size() << endl;
+        
+        lli counter = 0;
+        
+        for (auto it = countExact2WBs.begin(); it != countExact2WBs.end(); it++) {
+            
+            if (it->second == 2) {
+                counter++;
+            }
+            
+        }
+        
+        cout << "blocks with exactly 2 writebacks out of LLC: " << counter << endl;
+        cout << "resulting in a percentage of " << 100.0 * counter / countExact2WBs.size() << endl;
+    }
+    
+}
+
+/**
+ * Print the margins of error of a set sampling run, at 95% confidence; nothing is printed for a full run but the newline.
+ * Each group of sampled sets gives its own estimate of the total, and their spread is that of the sets
+ */
+static void printWriteBackMargin() {
+    
+    if (sampleShift != 0) {
+        long double total = 0;
+        
+        for (int i = 0; i < SAMPLE_GROUPS; i++) {
+            total += sampleGroups[i].writeBacks;
+        }
+        
+        long double mean = total / SAMPLE_GROUPS;
+        long double squares = 0;
+        
+        for (int i = 0; i < SAMPLE_GROUPS; i++) {
+            squares += (sampleGroups[i].writeBacks - mean) * (sampleGroups[i].writeBacks - mean);
+        }
+        
+        //the total is SAMPLE_GROUPS << sampleShift times the mean of the groups
+        long double margin = SAMPLE_T_QUANTILE * sqrt(squares / (SAMPLE_GROUPS - 1) / SAMPLE_GROUPS) * (SAMPLE_GROUPS << sampleShift);
+        cout << " +- " << (lli) (margin + 0.5);
+    }
+    
+    cout << endl;
+}
+
+/**
+ * The read hit ratio is a ratio of two sums over the groups, so its variance is that of the ratio estimator
+ */
+static void printReadHitRatioMargin() {
+    
+    if (sampleShift != 0) {
+        long double readHits = 0, totalReadAccess = 0;
+        
+        for (int i = 0; i < SAMPLE_GROUPS; i++) {
+            readHits += sampleGroups[i].readHits;
+            totalReadAccess += sampleGroups[i].totalReadAccess;
+        }
+        
+        long double ratio = readHits / totalReadAccess;
+        long double squares = 0;
+        
+        for (int i = 0; i < SAMPLE_GROUPS; i++) {
+            long double residual = sampleGroups[i].readHits - ratio * sampleGroups[i].totalReadAccess;
+            squares += residual * residual;
+        }
+        
+        long double meanReadAccess = totalReadAccess / SAMPLE_GROUPS;
+        long double margin = SAMPLE_T_QUANTILE * sqrt(squares / (SAMPLE_GROUPS - 1) / SAMPLE_GROUPS) / meanReadAccess;
+        cout << " +- " << fixed << setprecision(5) << margin;
+    }
+    
+    cout << endl;
+}
+
+/**
+ * Print the report of ICD; the counts of a set sampling run are scaled up to the whole cache
+ */
+static void postReport(const CompleteCache& l2AndCuckoo) {
+    lli hits, misses, writeBacks;
+    lli scale = 1LL << sampleShift;
+    hits = scale * l2AndCuckoo.getHitCount();
+    misses = scale * l2AndCuckoo.getMissCount();
+    writeBacks = scale * l2AndCuckoo.getWriteBackCount();
+    
+    PRINT_MULT('=', LINE_WIDTH - 7);
+    cout << "RESULTS\n";
+    PRINT_MULT('_', LINE_WIDTH - 7 - 8);
+    cout << "COMPLETE\n";
+    cout << "MISS RATE: \t\t" << fixed << setprecision(5) << 1.0 * misses / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * misses / (hits + misses) << "%" << endl;
+    cout << "HIT RATE: \t\t" << fixed << setprecision(5) << 1.0 * hits / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * hits / (hits + misses) << "%" <<  endl;
+    cout << "READ HIT COUNT: \t\t" << fixed << setprecision(5) << scale * l2AndCuckoo.readHits << endl;
+    cout << "TOTAL READ ACCESS COUNT: \t\t" << scale * l2AndCuckoo.totalReadAccess << endl;
+    cout << "READ HIT RATIO: \t\t" << fixed << setprecision(5) << 1.0 * l2AndCuckoo.readHits / l2AndCuckoo.totalReadAccess;
+    printReadHitRatioMargin();
+    cout << "WRITE BACK COUNT: \t" << writeBacks;
+    printWriteBackMargin();
+    cout << "TOTAL QUERIES: \t" << hits + misses << endl;
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+    
+    PRINT_MULT('_', LINE_WIDTH - 7 - 6);
+    hits = scale * l2AndCuckoo.getComponentNormal().getHitCount();
+    misses = scale * l2AndCuckoo.getComponentNormal().getMissCount();
+    writeBacks = scale * l2AndCuckoo.getComponentNormal().getWriteBackCount();
+    cout << "NORMAL\n";
+    cout << "MISS RATE: \t\t" << fixed << setprecision(5) << 1.0 * misses / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * misses / (hits + misses) << "%" << endl;
+    cout << "HIT RATE: \t\t" << fixed << setprecision(5) << 1.0 * hits / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * hits / (hits + misses) << "%" <<  endl;
+    cout << "WRITE BACK COUNT: \t" << writeBacks << endl;
+    cout << "WRITEBACKLOG SIZE: \t" << scale * l2AndCuckoo.getComponentNormal().writeBackLog.size() << endl;
+    cout << "NON RECURRING WRITEBACK COUNT: \t" << 1.0 * l2AndCuckoo.getComponentNormal().writeBackLog.size() / writeBacks << endl;
+    cout << "TOTAL QUERIES: \t" << hits + misses << endl;
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+    
+    PRINT_MULT('_', LINE_WIDTH - 7 - 6);
+    hits = scale * l2AndCuckoo.getComponentCuckoo().getHitCount();
+    misses = scale * l2AndCuckoo.getComponentCuckoo().getMissCount();
+    writeBacks = scale * l2AndCuckoo.getComponentCuckoo().getWriteBackCount();
+    cout << "CUCKOO\n";
+    cout << "MISS RATE: \t\t" << fixed << setprecision(5) << 1.0 * misses / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * misses / (hits + misses) << "%" << endl;
+    cout << "HIT RATE: \t\t" << fixed << setprecision(5) << 1.0 * hits / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * hits / (hits + misses) << "%" <<  endl;
+    cout << "WRITE BACK COUNT: \t" << writeBacks << endl;
+    cout << "DISPLACEMENT AVERAGE PER INSERTION VALUE: \t" << scale * l2AndCuckoo.getComponentCuckoo().dispAvgPerIns.value << endl;
+    cout << "DISPLACEMENT AVERAGE PER INSERTION COUNTER: \t" << scale * l2AndCuckoo.getComponentCuckoo().dispAvgPerIns.counter << endl;
+    cout << "DISPLACEMENT AVERAGE PER INSERTION: \t" << 1.0 * l2AndCuckoo.getComponentCuckoo().dispAvgPerIns.value / l2AndCuckoo.getComponentCuckoo().dispAvgPerIns.counter << endl;
+    
+    //insertions by the number of blocks they displaced, up to the longest path taken
+    int longestPath = CUCKOO_PATH_LENGTHS - 1;
+    
+    while ( (longestPath > 0) && (l2AndCuckoo.getComponentCuckoo().pathLengths[longestPath] == 0) ) {
+        longestPath--;
+    }
+    
+    for (int i = 0; i <= longestPath; i++) {
+        cout << "DISPLACEMENT PATH LENGTH " << i << ((i == CUCKOO_PATH_LENGTHS - 1) ? "+" : "") << ": \t" << scale * l2AndCuckoo.getComponentCuckoo().pathLengths[i] << endl;
+    }
+    
+    //upper ends of the power-of-two buckets the percentiles fall in (see LogHistogram)
+    for (int i = 0; i < tailPercentileCount; i++) {
+        cout << "DISPLACEMENT PER INSERTION P" << tailPercentileNames[i] << ": \t" << l2AndCuckoo.getComponentCuckoo().displacements.percentile(tailPercentiles[i]) << endl;
+    }
+    
+    cout << "DISPLACEMENT PER INSERTION MAX: \t" << l2AndCuckoo.getComponentCuckoo().displacements.getMax() << endl;
+    
+    cout << "DISPLACEMENT AVERAGE PER ACCESS VALUE: \t" << scale * l2AndCuckoo.getComponentCuckoo().dispAvgPerAcc.value << endl;
+    cout << "DISPLACEMENT AVERAGE PER ACCESS COUNTER: \t" << scale * l2AndCuckoo.getComponentCuckoo().dispAvgPerAcc.counter << endl;
+    cout << "DISPLACEMENT AVERAGE PER ACCESS: \t" << 1.0 * l2AndCuckoo.getComponentCuckoo().dispAvgPerAcc.value / l2AndCuckoo.getComponentCuckoo().dispAvgPerAcc.counter << endl;
+    cout << "FILTER LOOKUPS: \t" << scale * l2AndCuckoo.getComponentCuckoo().filterStats.lookups << endl;
+    double filterHitRate = 1.0 * l2AndCuckoo.getComponentCuckoo().filterStats.positives / l2AndCuckoo.getComponentCuckoo().filterStats.lookups;
+    double filterFalsePositiveRate = 1.0 * l2AndCuckoo.getComponentCuckoo().filterStats.falsePositives / (l2AndCuckoo.getComponentCuckoo().filterStats.lookups - l2AndCuckoo.getComponentCuckoo().filterStats.positives + l2AndCuckoo.getComponentCuckoo().filterStats.falsePositives);
+    cout << "FILTER HIT RATE: \t" << fixed << setprecision(5) << filterHitRate << "\t";
+    cout << fixed << setprecision(3) << 100.0 * filterHitRate << "%" << endl;
+    cout << "FILTER FALSE POSITIVE RATE: \t" << fixed << setprecision(5) << filterFalsePositiveRate << "\t";
+    cout << fixed << setprecision(3) << 100.0 * filterFalsePositiveRate << "%" << endl;
+    
+    //evicted blocks by the number of accesses to the cuckoo section they stayed for
+    for (int i = 0; i < LOG_HISTOGRAM_BUCKETS; i++) {
+        
+        if (l2AndCuckoo.getComponentCuckoo().evictionAges.getCount(i) != 0) {
+            cout << "EVICTION AGE UP TO " << LogHistogram::upperEnd(i) << ": \t" << scale * l2AndCuckoo.getComponentCuckoo().evictionAges.getCount(i) << endl;
+        }
+        
+    }
+    
+    for (int i = 0; i < tailPercentileCount; i++) {
+        cout << "EVICTION AGE P" << tailPercentileNames[i] << ": \t" << l2AndCuckoo.getComponentCuckoo().evictionAges.percentile(tailPercentiles[i]) << endl;
+    }
+    
+    cout << "EVICTION AGE MAX: \t" << l2AndCuckoo.getComponentCuckoo().evictionAges.getMax() << endl;
+    lli occupancy = 0;
+    
+    for (int i = 0; i < l2AndCuckoo.getComponentCuckoo().associativity; i++) {
+        occupancy += l2AndCuckoo.getComponentCuckoo().getOccupancy(i);
+    }
+    
+    double loadFactor = 1.0 * occupancy / ((lli) l2AndCuckoo.getComponentCuckoo().rowCount * l2AndCuckoo.getComponentCuckoo().associativity);
+    cout << "LOAD FACTOR: \t" << fixed << setprecision(5) << loadFactor << "\t";
+    cout << fixed << setprecision(3) << 100.0 * loadFactor << "%" << endl;
+    cout << "TOTAL QUERIES: \t" << hits + misses << endl;
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+    
+    time_t end = time(NULL);
+    time_t total = end - start;
+    cout << "TOTAL TIME: \t\t" << setfill('0') << setw(2) << total / 3600 << ":" << setw(2) << (total % 3600) / 60 << ":" << setw(2) << (total % 60) << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl;
+}
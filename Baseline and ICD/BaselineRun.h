@@ -0,0 +1,52 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef BaselineRun_h
+#define BaselineRun_h
+
+#include "RunConfig.h"
+
+#define BASELINE_VERSION "2.58 (Final Traces)" //printed in the reports of the LRU, ICD and sweep models; bump it when their results change
+
+/**
+ * Simulate the LRU baseline on a trace and print the report
+ * @return Exit status
+ */
+int runLru(const RunConfig& config);
+
+/**
+ * Simulate ICD, an LRU cache with config.cuckooWayCount of its ways displaced into a cuckoo region, and print the report
+ * @return Exit status
+ */
+int runIcd(const RunConfig& config);
+
+/**
+ * Simulate LRU caches of every power-of-two size from config.cacheKiB to config.maxCacheKiB in one pass
+ * (see StackDistanceLru) and print one line of statistics per size
+ * @return Exit status
+ */
+int runLruSweep(const RunConfig& config);
+
+/**
+ * Simulate the offline optimal replacement (see OptimalCache) with the geometry of the LRU baseline and print the report;
+ * the trace is read twice, so it cannot come from stdin
+ * @return Exit status
+ */
+int runOpt(const RunConfig& config);
+
+/**
+ * Simulate the write-aware variant of the offline optimal replacement (see OptimalCache) and print the report
+ * @return Exit status
+ */
+int runOptWriteAware(const RunConfig& config);
+
+#endif /* BaselineRun_h */
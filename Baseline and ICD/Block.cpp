@@ -58,6 +58,10 @@ Block Block::operator=(const Block &right) {
     return (*this);
 }
 
-BlockContent Block::getContent() const {
+const BlockContent& Block::getContent() const {
     return content;
-}
\ No newline at end of file
+}
+
+bool Block::getValid() const {
+    return isValid;
+}
@@ -11,13 +11,13 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #ifndef Block_h
 #define Block_h
 
-#include <string>
+#include "BlockValue.h"
 
 typedef long long unsigned int lli;
 
 struct BlockContent {
     lli addr;
-    std::string value;
+    BlockValue value;
 };
 
 class Block {
@@ -67,7 +67,12 @@ public:
      */
     void evict();
 
-    BlockContent getContent() const;
+    const BlockContent& getContent() const;
+    
+    /**
+     * @return isValid
+     */
+    bool getValid() const;
 };
 
 
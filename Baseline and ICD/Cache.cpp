@@ -9,17 +9,34 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 */
 
 #include "Cache.h"
+#include <cstdlib>
 
-Cache::Cache(int setCount, int initAssociativity, int initBlockOffset, int initIndexSize): setArr(setCount, CacheSet(initAssociativity, initBlockOffset)), writeBackCount(0), hitCount(0), missCount(0), bitsBeforeIndex(initBlockOffset + 2), indexSize(initIndexSize), totalReadAccess(0), readHits(0) {
+Cache::Cache(int setCount, int initAssociativity, int initBlockOffset, int initIndexSize): addrArr((size_t) checkGeometry(setCount, initAssociativity) * rowWaysFor(initAssociativity)), valueArr((size_t) setCount * initAssociativity), recencyArr((size_t) setCount * initAssociativity), validArr(setCount), dirtyArr(setCount), writeBackCount(0), hitCount(0), missCount(0), bitsBeforeIndex(initBlockOffset + 2), indexSize(initIndexSize), totalReadAccess(0), readHits(0) {
     rowCount = setCount;
     associativity = initAssociativity;
-    
+    rowWays = rowWaysFor(associativity);
+    blockMask = ~((1ULL << bitsBeforeIndex) - 1);
 }
 
 Cache::~Cache() {
     
 }
 
+int Cache::checkGeometry(int setCount, int associativity) {
+    
+    if ( (associativity < 1) || (associativity > CACHE_SET_MAX_WAYS) ) {
+        cout << "Associativity Must Be Between 1 And " << CACHE_SET_MAX_WAYS << "\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    if ( (setCount < 1) || ((setCount & (setCount - 1)) != 0) ) {
+        cout << "Set Count Must Be A Power Of Two\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    return setCount;
+}
+
 lli Cache::getWriteBackCount() const{
     return writeBackCount;
 }
@@ -32,13 +49,47 @@ lli Cache::getMissCount() const {
     return missCount;
 }
 
-pair<bool, const CacheBlock*> Cache::request(lli queryAddr, bool queryDirty, bool affectReadHitRatio, string value) {
+/**
+ * @return Index of the set of an address
+ */
+static inline lli indexOf(lli queryAddr, int bitsBeforeIndex, int indexSize) {
     lli setIndex = queryAddr >> bitsBeforeIndex;
     setIndex <<= (64 - indexSize);
     setIndex >>= 1;
     setIndex &= 0x7fffffffffffffff;
     setIndex >>= (63 - indexSize);
-    pair<bool, const CacheBlock*> ret = setArr.at(setIndex).request(queryAddr, queryDirty, value);
+    return setIndex;
+}
+
+pair<bool, Victim> Cache::request(lli queryAddr, bool queryDirty, bool affectReadHitRatio, const BlockValue& value) {
+    return account(CacheSet(*this, indexOf(queryAddr, bitsBeforeIndex, indexSize)).request<0>(queryAddr, queryDirty, value), affectReadHitRatio);
+}
+
+pair<bool, Victim> Cache::warm(lli queryAddr, bool queryDirty, bool affectReadHitRatio) {
+    return account(CacheSet(*this, indexOf(queryAddr, bitsBeforeIndex, indexSize)).request<0, false>(queryAddr, queryDirty, BlockValue()), affectReadHitRatio);
+}
+
+lli Cache::setOf(lli queryAddr) const {
+    return indexOf(queryAddr, bitsBeforeIndex, indexSize);
+}
+
+void Cache::prefetch(lli queryAddr) const {
+    prefetchSet(indexOf(queryAddr, bitsBeforeIndex, indexSize));
+}
+
+void Cache::prefetchSet(lli setIndex) const {
+    const lli* addrRow = addrArr.data() + setIndex * rowWays;
+    
+    for (int i = 0; i < rowWays; i += CACHE_LINE_SIZE / sizeof(lli)) {
+        __builtin_prefetch(addrRow + i, 1);
+    }
+    
+    __builtin_prefetch(&recencyArr[setIndex * associativity], 1);
+    __builtin_prefetch(&validArr[setIndex], 1);
+    __builtin_prefetch(&dirtyArr[setIndex], 1);
+}
+
+pair<bool, Victim> Cache::account(const pair<bool, Victim>& ret, bool affectReadHitRatio) {
     
     if (affectReadHitRatio) {
         totalReadAccess++;
@@ -54,12 +105,86 @@ pair<bool, const CacheBlock*> Cache::request(lli queryAddr, bool queryDirty, boo
     } else {
         missCount++;
         
-        if (ret.second->isDirty() == true) {
-            writeBackLog.insert(ret.second->content.addr >> ret.second->shiftCount);
+        if (ret.second.dirty == true) {
+            writeBackLog.insert(ret.second.content.addr >> bitsBeforeIndex);
             writeBackCount++;
         }
         
     }
     
     return ret;
-}
\ No newline at end of file
+}
+void Cache::save(SnapshotWriter& snapshot) const {
+    snapshot.put64(writeBackCount);
+    snapshot.put64(hitCount);
+    snapshot.put64(missCount);
+    snapshot.put64(readHits);
+    snapshot.put64(totalReadAccess);
+    snapshot.put64(writeBackLog.size());
+    
+    for (auto it = writeBackLog.begin(); it != writeBackLog.end(); it++) {
+        snapshot.put64(*it);
+    }
+    
+    lli filledSets = 0;
+    
+    for (int i = 0; i < rowCount; i++) {
+        filledSets += (validArr[i] != 0);
+    }
+    
+    snapshot.put64(filledSets);
+    
+    for (int i = 0; i < rowCount; i++) {
+        
+        if (validArr[i] == 0) {
+            continue;
+        }
+        
+        snapshot.put64(i);
+        snapshot.put64(validArr[i]);
+        snapshot.put64(dirtyArr[i]);
+        
+        for (int j = 0; j < associativity; j++) {
+            snapshot.put64(addrArr[(size_t) i * rowWays + j]);
+            snapshot.put8(recencyArr[(size_t) i * associativity + j]);
+            snapshot.putValue(valueArr[(size_t) i * associativity + j]);
+        }
+        
+    }
+    
+}
+
+void Cache::load(SnapshotReader& snapshot) {
+    writeBackCount = snapshot.get64();
+    hitCount = snapshot.get64();
+    missCount = snapshot.get64();
+    readHits = snapshot.get64();
+    totalReadAccess = snapshot.get64();
+    lli logSize = snapshot.get64();
+    
+    for (lli i = 0; i < logSize; i++) {
+        writeBackLog.insert(writeBackLog.end(), snapshot.get64());
+    }
+    
+    lli filledSets = snapshot.get64();
+    
+    for (lli i = 0; i < filledSets; i++) {
+        lli index = snapshot.get64();
+        
+        if (index >= (lli) rowCount) {
+            cout << "Snapshot Is Corrupted\n";
+            exit(EXIT_FAILURE);
+        }
+        
+        validArr[index] = snapshot.get64();
+        dirtyArr[index] = snapshot.get64();
+        
+        for (int j = 0; j < associativity; j++) {
+            addrArr[index * rowWays + j] = snapshot.get64();
+            recencyArr[index * associativity + j] = snapshot.get8();
+            snapshot.getValue(valueArr[index * associativity + j]);
+        }
+        
+    }
+    
+}
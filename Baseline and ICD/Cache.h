@@ -12,19 +12,54 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #define Cache_h
 
 #include "CacheSet.h"
+#include "LazyArray.h"
+#include "Snapshot.h"
 #include <set>
 
 using namespace std;
 
+#define CACHE_LINE_SIZE 64
+
 class Cache {
-private:
-    vector<CacheSet> setArr;
+friend class CacheSet;
+protected:
+    //structure of arrays; way w of set s is at [s * associativity + w], or [s * rowWays + w] in addrArr
+    //the arrays start zeroed and are backed on first touch, so untouched sets take no memory
+    LazyArray<lli> addrArr; //rows are cache-line aligned and padded to rowWays so that they can be compared in SIMD
+    LazyArray<BlockValue> valueArr;
+    LazyArray<uint8_t> recencyArr;
+    LazyArray<uint64_t> validArr;
+    LazyArray<uint64_t> dirtyArr;
+    int rowWays;
+    lli blockMask; //clears the offset bits of an address
     lli writeBackCount;
     lli hitCount;
     lli missCount;
     int bitsBeforeIndex;
     int indexSize;
     
+    /**
+     * Update the statistics with the outcome of a request
+     * @return The outcome
+     */
+    pair<bool, Victim> account(const pair<bool, Victim>& ret, bool affectReadHitRatio);
+    
+    /**
+     * Exit unless the geometry can be simulated
+     * @return setCount
+     */
+    static int checkGeometry(int setCount, int associativity);
+    
+    /**
+     * Prefetch the rows of a set into the host cache
+     */
+    void prefetchSet(lli setIndex) const;
+    
+    /**
+     * @return Index of the set of an address
+     */
+    lli setOf(lli queryAddr) const;
+    
 public:
     int rowCount;
     int associativity;
@@ -33,16 +68,27 @@ public:
     
     set<lli> writeBackLog;
     
+    /**
+     * @return Number of ways in a row of addrArr
+     */
+    static constexpr int rowWaysFor(int ways) {
+        return (ways <= 4) ? 4 : ((ways + 7) / 8 * 8); //a whole number of cache lines, or an aligned fraction of one
+    }
+    
     /**
      * Constructor
+     * @param setCount A power of two
+     * @param initAssociativity At most CACHE_SET_MAX_WAYS
      * @param initBlockOffset Number of rightmost bits that should be ignored
      */
     Cache(int setCount, int initAssociativity, int initBlockOffset, int initIndexSize);
     
+    Cache(const Cache&) = delete;
+    
     /**
      * Destructor; nothing to be done
      */
-    ~Cache();
+    virtual ~Cache();
     
     /**
      * @return writeBackCount
@@ -60,9 +106,31 @@ public:
     lli getMissCount() const;
     
     /**
-     * @return pair<hit?, former data>
+     * @return pair<hit?, former data>; former data is meaningless on a hit
+     */
+    pair<bool, Victim> request(lli queryAddr, bool queryDirty, bool affectReadHitRatio, const BlockValue& value);
+    
+    /**
+     * Send a query without its value, as functional warming does; the tags, the dirty bits and the statistics are
+     * updated as by request(), but the values of the blocks are left untouched and that of the victim is not reported
+     * @return pair<hit?, former data>; former data is meaningless on a hit
+     */
+    pair<bool, Victim> warm(lli queryAddr, bool queryDirty, bool affectReadHitRatio);
+    
+    /**
+     * Start loading the set of an upcoming query into the host cache; a hint only, the state is left untouched
+     */
+    void prefetch(lli queryAddr) const;
+    
+    /**
+     * Write the state to a snapshot; only the sets holding blocks are written
+     */
+    void save(SnapshotWriter& snapshot) const;
+    
+    /**
+     * Read the state back from a snapshot into a cache just constructed with the same geometry
      */
-    pair<bool, const CacheBlock*> request(lli queryAddr, bool queryDirty, bool affectReadHitRatio, string value);
+    void load(SnapshotReader& snapshot);
 };
 
 
@@ -8,65 +8,132 @@ Please cite the following paper when using the provided source codes:
 M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
 */
 
+
 #include "CacheSet.h"
-#include <algorithm>
+#include "Cache.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+CacheSet::CacheSet(Cache& owner, lli index): cache(owner), addrRow(owner.addrArr.data() + index * owner.rowWays), valueRow(&owner.valueArr[index * owner.associativity]), recencyRow(&owner.recencyArr[index * owner.associativity]), valid(owner.validArr[index]), dirty(owner.dirtyArr[index]) {
+    
+}
 
-CacheSet::CacheSet(int initAssociativity, int initBlockOffset): blockArr(initAssociativity, CacheBlock(initBlockOffset)), associativity(initAssociativity) {
-    usageHistory.clear();
+template<int Ways>
+uint64_t CacheSet::match(lli queryAddr) const {
+    uint64_t hits = 0;
+    
+#if defined(__AVX2__)
+    const int rowWays = (Ways != 0) ? Cache::rowWaysFor(Ways) : cache.rowWays;
+    __m256i query = _mm256_set1_epi64x(queryAddr & cache.blockMask);
+    __m256i mask = _mm256_set1_epi64x(cache.blockMask);
     
-    for (int i = 0; i < associativity; i++) {
-        empty.push_back(i); //all indexes are empty
+    for (int i = 0; i < rowWays; i += 4) {
+        __m256i row = _mm256_and_si256(_mm256_load_si256((const __m256i*) (addrRow + i)), mask);
+        hits |= (uint64_t) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(row, query))) << i;
     }
+#elif defined(__SSE4_1__)
+    const int rowWays = (Ways != 0) ? Cache::rowWaysFor(Ways) : cache.rowWays;
+    __m128i query = _mm_set1_epi64x(queryAddr & cache.blockMask);
+    __m128i mask = _mm_set1_epi64x(cache.blockMask);
     
+    for (int i = 0; i < rowWays; i += 2) {
+        __m128i row = _mm_and_si128(_mm_load_si128((const __m128i*) (addrRow + i)), mask);
+        hits |= (uint64_t) _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(row, query))) << i;
+    }
+#else
+    const int ways = (Ways != 0) ? Ways : cache.associativity;
+    lli query = queryAddr & cache.blockMask;
+    
+    for (int i = 0; i < ways; i++) {
+        hits |= (uint64_t) ((addrRow[i] & cache.blockMask) == query) << i;
+    }
+#endif
+    
+    return hits & valid;
 }
 
-CacheSet::~CacheSet() {
+template<int Ways>
+void CacheSet::promote(int way) {
+    const int ways = (Ways != 0) ? Ways : cache.associativity;
+    uint8_t rank = recencyRow[way];
+    
+    for (int i = 0; i < ways; i++) {
+        recencyRow[i] += (recencyRow[i] < rank);
+    }
     
+    recencyRow[way] = 0;
 }
 
-const CacheBlock* CacheSet::insert(lli newAddr, bool dirty, string value) {
+template<int Ways, bool Values>
+Victim CacheSet::insert(lli newAddr, bool newDirty, const BlockValue& value) {
+    const int ways = (Ways != 0) ? Ways : cache.associativity;
+    const uint64_t fullMask = (ways == 64) ? ~0ULL : ((1ULL << ways) - 1);
+    int insertIndex;
     
-    if (empty.size() != 0) { //there are some empty places; 
-        const CacheBlock* ret = (blockArr.at(empty.at(0)).set(newAddr, dirty, value));
-        usageHistory.insert(usageHistory.begin(), empty.at(0));
-        empty.erase(empty.begin());
-        return ret;
+    if (valid != fullMask) { //there are some empty places; they are filled in order
+        insertIndex = __builtin_ctzll(~valid);
+        recencyRow[insertIndex] = __builtin_popcountll(valid); //behind every filled way
+    } else {
+        //there are no empty places
+        //LRU
+        insertIndex = 0;
+        
+        while (recencyRow[insertIndex] != ways - 1) {
+            insertIndex++;
+        }
+        
     }
     
-    //there are no empty places
-    //LRU
-    int insertIndex = usageHistory.at(usageHistory.size() - 1);
-    usageHistory.pop_back(); //remove last element
-    usageHistory.insert(usageHistory.begin(), insertIndex); //the new query placed at the front
-    return blockArr.at(insertIndex).set(newAddr, dirty, value);
+    promote<Ways>(insertIndex); //the new query placed at the front
+    
+    uint64_t bit = 1ULL << insertIndex;
+    Victim former;
+    former.dirty = (valid & dirty & bit) != 0;
+    former.content.addr = addrRow[insertIndex];
+    
+    if (Values) {
+        former.content.value = valueRow[insertIndex];
+        valueRow[insertIndex] = value;
+    }
+    
+    addrRow[insertIndex] = newAddr;
+    valid |= bit;
+    dirty = newDirty ? (dirty | bit) : (dirty & ~bit);
+    return former;
 }
 
-pair<bool, const CacheBlock*> CacheSet::request(lli queryAddr, bool queryDirty, string value) {
+template<int Ways, bool Values>
+pair<bool, Victim> CacheSet::request(lli queryAddr, bool queryDirty, const BlockValue& value) {
+    uint64_t hits = match<Ways>(queryAddr);
     
-    for (int i = 0; i < associativity; i++) {
+    if (hits != 0) { //if hit
+        int way = __builtin_ctzll(hits);
+        promote<Ways>(way); //place it in the front
         
-        if (blockArr.at(i) == queryAddr) { //if hit
-            vector<int>::iterator search = find(usageHistory.begin(), usageHistory.end(), i);
-            
-            if (search == usageHistory.end()) {
-                cout << "Hit Occured While Its Index Doesn't Exist In usageHistory\n";
-                exit(EXIT_FAILURE);
-            }
-            
-            usageHistory.erase(search); //remove from former place
-            usageHistory.insert(usageHistory.begin(), i); //place it in the front
-            
-            //check for dirty
-            if (queryDirty) {
-                blockArr.at(i).setDirty();
-            }
-
-            blockArr.at(i).setVal(value); //set new value
-            return make_pair(true, nullptr);
+        //check for dirty
+        if (queryDirty) {
+            dirty |= 1ULL << way;
         }
         
+        if (Values) {
+            valueRow[way] = value; //set new value
+        }
+        
+        return make_pair(true, Victim());
     }
     
     //miss
-    return make_pair(false, insert(queryAddr, queryDirty, value));
+    return make_pair(false, insert<Ways, Values>(queryAddr, queryDirty, value));
 }
+
+//the runtime associativity of Cache and the associativities of the standard FixedCache geometries
+template pair<bool, Victim> CacheSet::request<0, true>(lli queryAddr, bool queryDirty, const BlockValue& value);
+template pair<bool, Victim> CacheSet::request<4, true>(lli queryAddr, bool queryDirty, const BlockValue& value);
+template pair<bool, Victim> CacheSet::request<16, true>(lli queryAddr, bool queryDirty, const BlockValue& value);
+template pair<bool, Victim> CacheSet::request<0, false>(lli queryAddr, bool queryDirty, const BlockValue& value);
+template pair<bool, Victim> CacheSet::request<4, false>(lli queryAddr, bool queryDirty, const BlockValue& value);
+template pair<bool, Victim> CacheSet::request<16, false>(lli queryAddr, bool queryDirty, const BlockValue& value);
@@ -8,45 +8,74 @@ Please cite the following paper when using the provided source codes:
 M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
 */
 
+
+
 #ifndef CacheSet_h
 #define CacheSet_h
 
 #include <vector>
 #include <iostream>
-#include "CacheBlock.h"
+#include <cstdint>
+#include "Block.h"
+
+#define CACHE_SET_MAX_WAYS 64
 
 using namespace std;
 
+class Cache;
+
+/**
+ * The block replaced by a fill, reported by value
+ */
+struct Victim {
+    bool dirty; //false if the replaced block was clean or invalid
+    BlockContent content;
+};
+
+/**
+ * One set of a Cache; a view of the rows of the set in the structure-of-arrays storage of the Cache.
+ * The Ways parameter of the methods is the associativity when known at compile time, and 0 otherwise;
+ * CacheSet.cpp instantiates them for 0 and for the associativities of FixedCache.
+ * Without Values, the values of the blocks are neither stored nor reported, which is enough to warm the set up
+ */
 class CacheSet {
 private:
-    vector<CacheBlock> blockArr;
-    vector<int> usageHistory;
-    vector<int> empty;
-    const int associativity;
+    const Cache& cache;
+    lli* addrRow; //address of the block in each way; compared to find hits
+    BlockValue* valueRow;
+    uint8_t* recencyRow; //LRU stack position of each way, 0 being the most recently used; filled ways only
+    uint64_t& valid; //bit per way
+    uint64_t& dirty; //bit per way
+    
+    /**
+     * @return Bit mask of the valid ways holding the block of queryAddr
+     */
+    template<int Ways> uint64_t match(lli queryAddr) const;
+    
+    /**
+     * Make a way the most recently used one; ways more recent than it age by one
+     */
+    template<int Ways> void promote(int way);
     
     /**
      * Insert a new block
      * @return Former data
      */
-    const CacheBlock* insert(lli newAddr, bool dirty, string value);
+    template<int Ways, bool Values> Victim insert(lli newAddr, bool newDirty, const BlockValue& value);
     
 public:
     
     /**
      * Constructor
-     * @param initBlockOffset Number of rightmost bits ignored for each block
-     */
-    CacheSet(int initAssociativity, int initBlockOffset);
-    
-    /**
-     * Destructor; nothing to be done
+     * @param owner The cache storing the set
+     * @param index Index of the set
      */
-    ~CacheSet();
+    CacheSet(Cache& owner, lli index);
     
     /**
-     * @return pair<hit?, former data>
+     * @return pair<hit?, former data>; former data is meaningless on a hit
      */
-    pair<bool, const CacheBlock*> request(lli queryAddr, bool queryDirty, string value);
+    template<int Ways, bool Values = true> pair<bool, Victim> request(lli queryAddr, bool queryDirty, const BlockValue& value);
 };
 
 
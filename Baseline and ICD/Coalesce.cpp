@@ -57,4 +57,44 @@ void Coalesce::writeQuery(lli addr, lli qCounter) {
 
 void Coalesce::dirtyEviction(lli addr, lli qCounter) {
     history[addr] = qCounter;
-}
\ No newline at end of file
+}
+
+void Coalesce::save(SnapshotWriter& snapshot) const {
+    snapshot.put64(total);
+
+    for (int i = 0; i < lt10s.size(); i++) {
+        snapshot.put64(lt10s.at(i));
+    }
+
+    for (int i = 0; i < lt2s.size(); i++) {
+        snapshot.put64(lt2s.at(i));
+    }
+
+    snapshot.put64(history.size());
+
+    for (auto it = history.begin(); it != history.end(); it++) {
+        snapshot.put64(it->first);
+        snapshot.put64(it->second);
+    }
+
+}
+
+void Coalesce::load(SnapshotReader& snapshot) {
+    total = snapshot.get64();
+
+    for (int i = 0; i < lt10s.size(); i++) {
+        lt10s.at(i) = snapshot.get64();
+    }
+
+    for (int i = 0; i < lt2s.size(); i++) {
+        lt2s.at(i) = snapshot.get64();
+    }
+
+    lli historySize = snapshot.get64();
+
+    for (lli i = 0; i < historySize; i++) {
+        lli addr = snapshot.get64();
+        history[addr] = snapshot.get64();
+    }
+
+}
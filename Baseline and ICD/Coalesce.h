@@ -13,6 +13,7 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 #include <map>
 #include <vector>
+#include "Snapshot.h"
 
 typedef long long unsigned int lli;
 
@@ -23,6 +24,8 @@ public:
     Coalesce();
     void writeQuery(lli addr, lli qCounter);
     void dirtyEviction(lli addr, lli qCounter);
+    void save(SnapshotWriter& snapshot) const;
+    void load(SnapshotReader& snapshot);
 
     lli total;
     vector<lli> lt10s;
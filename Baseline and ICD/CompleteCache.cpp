@@ -16,7 +16,7 @@ int CompleteCache::tileCount_log2 = 0;
 int CompleteCache::coherenceUnit_log2 = 0;
 int CompleteCache::cuckooWayCount = 0;
 
-CompleteCache::CompleteCache(int initRowCount, int initAssociativity, int cuckooSetCount, int cuckooSetCount_log2, int initCuckooWayCount, int initBlockOffset, unsigned int initThreshold, int initIndexSize, int initRowCount_log2, int initTileCount_log2, int initCoherenceUnit_log2): fVec({f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15}), associativity(initAssociativity), blockOffset(initBlockOffset), threshold(initThreshold), hits(0), misses(0), writeBackCount(0), componentCuckoo(cuckooSetCount, initCuckooWayCount, initBlockOffset, fVec, initThreshold), componentNormal(initRowCount, initAssociativity, initBlockOffset, initIndexSize), readHits(0), totalReadAccess(0) {
+CompleteCache::CompleteCache(int initRowCount, int initAssociativity, int cuckooSetCount, int cuckooSetCount_log2, int initCuckooWayCount, int initBlockOffset, unsigned int initThreshold, int initIndexSize, int initRowCount_log2, int initTileCount_log2, int initCoherenceUnit_log2, int initSearchDepth): associativity(initAssociativity), blockOffset(initBlockOffset), threshold(initThreshold), hits(0), misses(0), writeBackCount(0), componentCuckoo(cuckooSetCount, initCuckooWayCount, initBlockOffset, initThreshold, initSearchDepth), componentNormal(initRowCount, initAssociativity, initBlockOffset, initIndexSize), readHits(0), totalReadAccess(0) {
     cuckooRowCount = cuckooSetCount;
     cuckooRowCount_log2 = cuckooSetCount_log2;
     tileCount_log2 = initTileCount_log2;
@@ -28,9 +28,22 @@ CompleteCache::~CompleteCache() {
     
 }
 
-QueryRet CompleteCache::query(lli addr, bool l1EvictDirty, bool affectReadHitRatio, string value) {
-    pair<bool, const CacheBlock*> l2Result = componentNormal.request(addr, l1EvictDirty, affectReadHitRatio, value);
-    pair<bool, const CuckooBlock*> cuckooResult;
+void CompleteCache::prefetch(lli addr) const {
+    componentNormal.prefetch(addr);
+    componentCuckoo.prefetch(addr);
+}
+
+QueryRet CompleteCache::query(lli addr, bool l1EvictDirty, bool affectReadHitRatio, const BlockValue& value) {
+    return access<true>(addr, l1EvictDirty, affectReadHitRatio, value);
+}
+
+QueryRet CompleteCache::warm(lli addr, bool l1EvictDirty, bool affectReadHitRatio) {
+    return access<false>(addr, l1EvictDirty, affectReadHitRatio, BlockValue());
+}
+
+template<bool Values>
+QueryRet CompleteCache::access(lli addr, bool l1EvictDirty, bool affectReadHitRatio, const BlockValue& value) {
+    pair<bool, Victim> l2Result = Values ? componentNormal.request(addr, l1EvictDirty, affectReadHitRatio, value) : componentNormal.warm(addr, l1EvictDirty, affectReadHitRatio);
     QueryRet toRet;
 
     if (affectReadHitRatio == true) {
@@ -48,9 +61,7 @@ QueryRet CompleteCache::query(lli addr, bool l1EvictDirty, bool affectReadHitRat
         toRet.dirtyEviction = false;
         toRet.evictedContent.addr = -1;
     } else { //miss
-        cuckooResult = componentCuckoo.remove(addr); //lookup cuckoo
-        
-        if (cuckooResult.first == true) { //found in cuckoo
+        if (componentCuckoo.remove(addr)) { //lookup cuckoo; found in cuckoo
             hits++;
             
             if (affectReadHitRatio == true) {
@@ -68,9 +79,9 @@ QueryRet CompleteCache::query(lli addr, bool l1EvictDirty, bool affectReadHitRat
         toRet.dirtyEviction = false;
         toRet.evictedContent.addr = -1;
 
-        if (l2Result.second->isDirty() == true) { //dirty eviction from l2
+        if (l2Result.second.dirty == true) { //dirty eviction from l2
             //block evicted from l2 was dirty
-            cuckooResult = componentCuckoo.insert(l2Result.second->getContent().addr, l2Result.second->getContent().value);
+            pair<bool, const CuckooBlock*> cuckooResult = componentCuckoo.insert(l2Result.second.content.addr, l2Result.second.content.value);
             //block inserted in the cuckoo section
 
             if (cuckooResult.first == true) { //dirty eviction from cuckoo
@@ -79,7 +90,6 @@ QueryRet CompleteCache::query(lli addr, bool l1EvictDirty, bool affectReadHitRat
                 toRet.dirtyEviction = true;
                 toRet.evictedContent.addr = cuckooResult.second->getContent().addr;
                 toRet.evictedContent.value = cuckooResult.second->getContent().value;
-                delete cuckooResult.second;
             }
 
         }
@@ -108,4 +118,24 @@ const Cuckoo& CompleteCache::getComponentCuckoo() const {
 
 const Cache& CompleteCache::getComponentNormal() const {
     return componentNormal;
-}
\ No newline at end of file
+}
+
+void CompleteCache::save(SnapshotWriter& snapshot) const {
+    snapshot.put64(hits);
+    snapshot.put64(misses);
+    snapshot.put64(writeBackCount);
+    snapshot.put64(readHits);
+    snapshot.put64(totalReadAccess);
+    componentNormal.save(snapshot);
+    componentCuckoo.save(snapshot);
+}
+
+void CompleteCache::load(SnapshotReader& snapshot) {
+    hits = snapshot.get64();
+    misses = snapshot.get64();
+    writeBackCount = snapshot.get64();
+    readHits = snapshot.get64();
+    totalReadAccess = snapshot.get64();
+    componentNormal.load(snapshot);
+    componentCuckoo.load(snapshot);
+}
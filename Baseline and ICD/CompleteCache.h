@@ -22,7 +22,6 @@ struct QueryRet {
 
 class CompleteCache {
 public:
-    vector<lli (*)(lli)> fVec;
     int associativity;
     int blockOffset;
     unsigned int threshold;
@@ -70,89 +69,14 @@ public:
     }
     */
 
-    //new hash function (supports more than 4 ways)
-    static inline unsigned int skew(int64_t addr, unsigned int way) {
-        uint64_t blockAddr;
-
-        blockAddr = addr >> 6;
-
-        blockAddr+=way*144;
-
-        blockAddr += (blockAddr << 12);
-        blockAddr ^= (blockAddr >> 22);
-        blockAddr += (blockAddr << 4);
-        blockAddr ^= (blockAddr >> 9);
-        blockAddr += (blockAddr << 10);
-        blockAddr ^= (blockAddr >> 2);
-        blockAddr += (blockAddr << 7);
-        blockAddr ^= (blockAddr >> 12);
-
-        return (blockAddr % cuckooRowCount);
-    }
-    
-    static inline lli f0(lli addr) {
-        return skew(addr, 0);
-    }
+    //new hash function (supports more than 4 ways): see SkewHash
     
-    static inline lli f1(lli addr) {
-        return skew(addr, 1);
-    }
-    
-    static inline lli f2(lli addr) {
-        return skew(addr, 2);
-    }
-    
-    static inline lli f3(lli addr) {
-        return skew(addr, 3);
-    }
-
-    static inline lli f4(lli addr) {
-        return skew(addr, 4);
-    }
-
-    static inline lli f5(lli addr) {
-        return skew(addr, 5);
-    }
-
-    static inline lli f6(lli addr) {
-        return skew(addr, 6);
-    }
-
-    static inline lli f7(lli addr) {
-        return skew(addr, 7);
-    }
-
-    static inline lli f8(lli addr) {
-        return skew(addr, 8);
-    }
-
-    static inline lli f9(lli addr) {
-        return skew(addr, 9);
-    }
-
-    static inline lli f10(lli addr) {
-        return skew(addr, 10);
-    }
-
-    static inline lli f11(lli addr) {
-        return skew(addr, 11);
-    }
-
-    static inline lli f12(lli addr) {
-        return skew(addr, 12);
-    }
-
-    static inline lli f13(lli addr) {
-        return skew(addr, 13);
-    }
-
-    static inline lli f14(lli addr) {
-        return skew(addr, 14);
-    }
-
-    static inline lli f15(lli addr) {
-        return skew(addr, 15);
-    }
+    /**
+     * Body of query() and warm(); without Values, the normal section neither stores the value nor reports that of
+     * its victim, and a dirty victim is displaced into the cuckoo section with an empty value
+     */
+    template<bool Values>
+    QueryRet access(lli addr, bool l1EvictDirty, bool affectReadHitRatio, const BlockValue& value);
 
 public:
     Cuckoo componentCuckoo;
@@ -160,7 +84,7 @@ public:
     /**
      * Constructor
      */
-    CompleteCache(int initRowCount, int initAssociativity, int cuckooSetCount, int cuckooSetCount_log2, int initCuckooWayCount, int initBlockOffset, unsigned int initThreshold, int initIndexSize, int initRowCount_log2, int initTileCount_log2, int initCoherenceUnit_log2);
+    CompleteCache(int initRowCount, int initAssociativity, int cuckooSetCount, int cuckooSetCount_log2, int initCuckooWayCount, int initBlockOffset, unsigned int initThreshold, int initIndexSize, int initRowCount_log2, int initTileCount_log2, int initCoherenceUnit_log2, int initSearchDepth);
     
     /**
      * Destructor; nothing to be done
@@ -172,7 +96,17 @@ public:
      * @return <dirty eviction?, former data>
      * @return <true, former data> / <false, nullptr> //DELETEing former data is caller's responsibility
      */
-    QueryRet query(lli addr, bool l1EvictDirty, bool affectReadHitRatio, string value);
+    QueryRet query(lli addr, bool l1EvictDirty, bool affectReadHitRatio, const BlockValue& value);
+    
+    /**
+     * Send a query without its value, as functional warming does; the blocks move and the statistics are updated as by query()
+     */
+    QueryRet warm(lli addr, bool l1EvictDirty, bool affectReadHitRatio);
+    
+    /**
+     * Start loading the normal set and the cuckoo rows of an upcoming query into the host cache
+     */
+    void prefetch(lli addr) const;
     
     /**
      * @return hits
@@ -198,6 +132,16 @@ public:
      * @return componentNormal
      */
     const Cache& getComponentNormal() const;
+    
+    /**
+     * Write the state of both sections to a snapshot
+     */
+    void save(SnapshotWriter& snapshot) const;
+    
+    /**
+     * Read the state back from a snapshot into a cache just constructed with the same geometry
+     */
+    void load(SnapshotReader& snapshot);
 
 };
 
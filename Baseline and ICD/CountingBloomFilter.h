@@ -0,0 +1,134 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef CountingBloomFilter_h
+#define CountingBloomFilter_h
+
+#include "Block.h"
+#include <cstdint>
+#include <vector>
+
+#define COUNTING_BLOOM_COUNTERS_PER_BLOCK 16 //counters per block the filter is sized for
+#define COUNTING_BLOOM_HASHES 3 //counters set by each block; about 0.5% false positives when full
+#define COUNTING_BLOOM_SATURATED 255
+
+using namespace std;
+
+/**
+ * A counting Bloom filter of blocks, which supports removing the blocks it holds. It never answers that a block it
+ * holds is absent, so it can stand in front of a lookup without changing its outcome. A counter that saturates is
+ * never decremented again, which keeps that true at the price of a few more false positives
+ */
+class CountingBloomFilter {
+private:
+    vector<uint8_t> counters;
+    uint64_t mask;
+    int shiftCount; //blockOffset + byteOffset, as in Block
+    
+    /**
+     * @return The hash the counters of the block of addr are derived from (finalizer of MurmurHash3)
+     */
+    inline uint64_t hashOf(lli addr) const {
+        uint64_t key = addr >> shiftCount;
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+        return key;
+    }
+    
+    /**
+     * @return Index of counter i of a block; double hashing on the two halves of its hash
+     */
+    inline uint64_t counterOf(uint64_t hash, int i) const {
+        return ((hash & 0xffffffff) + i * ((hash >> 32) | 1)) & mask;
+    }
+    
+public:
+    /**
+     * Constructor
+     * @param capacity Number of blocks the filter holds at most
+     * @param initBlockOffset Number of rightmost bits that should be ignored, as for Block
+     */
+    CountingBloomFilter(lli capacity, int initBlockOffset): shiftCount(initBlockOffset + 2) {
+        uint64_t size = 1;
+        
+        while (size < (uint64_t) capacity * COUNTING_BLOOM_COUNTERS_PER_BLOCK) {
+            size <<= 1;
+        }
+        
+        counters.assign(size, 0);
+        mask = size - 1;
+    }
+    
+    /**
+     * Add the block of addr; a block is added once for each time it is inserted
+     */
+    inline void add(lli addr) {
+        uint64_t hash = hashOf(addr);
+        
+        for (int i = 0; i < COUNTING_BLOOM_HASHES; i++) {
+            uint8_t& counter = counters[counterOf(hash, i)];
+            counter += (counter != COUNTING_BLOOM_SATURATED);
+        }
+        
+    }
+    
+    /**
+     * Remove the block of addr, which must have been added
+     */
+    inline void remove(lli addr) {
+        uint64_t hash = hashOf(addr);
+        
+        for (int i = 0; i < COUNTING_BLOOM_HASHES; i++) {
+            uint8_t& counter = counters[counterOf(hash, i)];
+            counter -= (counter != COUNTING_BLOOM_SATURATED);
+        }
+        
+    }
+    
+    /**
+     * @return False only if the block of addr is absent
+     */
+    inline bool mayContain(lli addr) const {
+        uint64_t hash = hashOf(addr);
+        bool present = true;
+        
+        for (int i = 0; i < COUNTING_BLOOM_HASHES; i++) {
+            present &= (counters[counterOf(hash, i)] != 0);
+        }
+        
+        return present;
+    }
+    
+    /**
+     * Start loading the counters of an upcoming query into the host cache
+     */
+    inline void prefetch(lli addr) const {
+        uint64_t hash = hashOf(addr);
+        
+        for (int i = 0; i < COUNTING_BLOOM_HASHES; i++) {
+            __builtin_prefetch(&counters[counterOf(hash, i)]);
+        }
+        
+    }
+    
+    /**
+     * Remove every block
+     */
+    void clear() {
+        counters.assign(counters.size(), 0);
+    }
+};
+
+#endif /* CountingBloomFilter_h */
@@ -10,11 +10,21 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 #include "Cuckoo.h"
 
-Cuckoo::Cuckoo(int initRowCount, int wayCount, int initBlockOffset, vector<lli (*)(lli)> initF, unsigned int initThreshold): rowCount(initRowCount), associativity(wayCount), blockOffset(initBlockOffset), fIndex(0), writeBackCount(0), threshold(initThreshold), hits(0), misses(0), dispAvgPerAcc({0, 0}), dispAvgPerIns({0, 0}) {
+Cuckoo::Cuckoo(int initRowCount, int wayCount, int initBlockOffset, unsigned int initThreshold, int initSearchDepth): hash(initRowCount), rows(SkewHash::rowBufferSize(wayCount)), blockOffset(initBlockOffset), fIndex(0), writeBackCount(0), threshold(initThreshold), hits(0), misses(0), carried(initBlockOffset), filter((lli) initRowCount * wayCount, initBlockOffset), searchDepth(initSearchDepth), rowCount(initRowCount), associativity(wayCount), dispAvgPerIns({0, 0}), dispAvgPerAcc({0, 0}), filterStats({0, 0, 0}) {
+    
+    content.reserve(associativity); //a way is moved whenever the vector grows
     
     for (int i = 0; i < associativity; i++) {
-        CuckooWay newCol(rowCount, initF.at(i), blockOffset);
-        content.push_back(newCol);
+        content.emplace_back(rowCount, blockOffset);
+    }
+    
+    for (int i = 0; i < CUCKOO_PATH_LENGTHS; i++) {
+        pathLengths[i] = 0;
+    }
+    
+    if (searchDepth != 0) {
+        nodes.reserve(CUCKOO_SEARCH_MAX_NODES); //the nodes are never reallocated during a search
+        path.reserve(searchDepth + 1);
     }
     
 }
@@ -23,51 +33,169 @@ Cuckoo::~Cuckoo() {
     
 }
 
-pair<bool, const CuckooBlock*> Cuckoo::remove(lli addr) {
-    pair<bool, const CuckooBlock*> ret;
+bool Cuckoo::remove(lli addr) {
     dispAvgPerAcc.counter++;
+    filterStats.lookups++;
+    
+    if (!filter.mayContain(addr)) {
+        misses++; //a sure miss; no way is probed
+        return false;
+    }
+    
+    filterStats.positives++;
+    hash.rows(addr, associativity, rows.data()); //every way is probed on a miss, so their rows are computed together
     
     for (int i = 0; i < associativity; i++) {
-        ret = content.at(i).remove(addr);
         
-        if (ret.first == true) {
+        if (content[i].remove(rows[i], addr)) {
+            filter.remove(addr);
             hits++;
-            return ret; //hit
+            return true; //hit
         }
         
     }
     
     //miss
+    filterStats.falsePositives++;
     misses++;
-    ret.first = false;
-    ret.second = nullptr;
-    return ret;
+    return false;
 }
 
-pair<bool, const CuckooBlock*> Cuckoo::insert(lli addr, string value) {
-    CuckooBlock *looper = new CuckooBlock(*(content.at(fIndex).insert(addr, 0, value)));
-    fIndex++;
-    fIndex %= associativity;
+void Cuckoo::prefetch(lli addr) const {
+    filter.prefetch(addr);
+    hash.rows(addr, associativity, rows.data());
+    
+    for (int i = 0; i < associativity; i++) {
+        content[i].prefetch(rows[i]);
+    }
+    
+}
+
+pair<bool, const CuckooBlock*> Cuckoo::insert(lli addr, const BlockValue& value) {
+    lli displaced = dispAvgPerIns.value;
+    filter.add(addr);
+    carried.set(addr, 0, dispAvgPerAcc.counter, value);
     dispAvgPerIns.counter++;
     dispAvgPerAcc.counter++;
+    bool evicted = (searchDepth == 0) ? walk() : search();
+    displaced = dispAvgPerIns.value - displaced;
+    pathLengths[(displaced < CUCKOO_PATH_LENGTHS - 1) ? displaced : CUCKOO_PATH_LENGTHS - 1]++;
+    displacements.add(displaced);
+    
+    if (evicted) {
+        writeBackCount++; //evict and write back to PCM
+        evictionAges.add(dispAvgPerAcc.counter - carried.insertedAt);
+        filter.remove(carried.getContent().addr);
+        return make_pair(true, &carried);
+    }
+
+    return make_pair(false, nullptr); //no dirty eviction
+}
+
+bool Cuckoo::walk() {
+    content[fIndex].insert(hash(carried.getContent().addr, fIndex), carried); //carried now holds the block it displaced
+    fIndex++;
+    fIndex %= associativity;
     
-    while (looper->isValid == true) {
-        looper->counter++;
+    while (carried.isValid == true) {
+        carried.counter++;
         dispAvgPerIns.value++;
         dispAvgPerAcc.value++;
         
-        if (looper->counter >= threshold) {
-            writeBackCount++; //evict and write back to PCM
-            return make_pair(true, looper); //caller should delete it!
+        if ((unsigned int) carried.counter >= threshold) { //the counter is never negative
+            return true;
         }
         
-        *looper = *(content.at(fIndex).insert(looper->getContent().addr, looper->counter, looper->getContent().value));
+        content[fIndex].insert(hash(carried.getContent().addr, fIndex), carried);
         fIndex++;
         fIndex %= associativity;
     }
 
-    delete looper;
-    return make_pair(false, nullptr); //no dirty eviction
+    return false;
+}
+
+bool Cuckoo::search() {
+    nodes.clear();
+    hash.rows(carried.getContent().addr, associativity, rows.data());
+    
+    //the slots of the new block itself; the way the walk would start from is tried first
+    for (int i = 0; i < associativity; i++) {
+        int way = (fIndex + i) % associativity;
+        nodes.push_back({way, rows[way], -1, 0});
+    }
+    
+    fIndex++;
+    fIndex %= associativity;
+    int target = -1;
+    int victim = -1;
+    
+    //nodes are visited in order of depth, so the first empty slot found is the nearest one
+    for (int head = 0; head < (int) nodes.size(); head++) {
+        const SearchNode node = nodes[head]; //a copy, as the search appends to nodes
+        const CuckooSlot& block = content[node.way].getBlock(node.row);
+        
+        if (!block.isValid) {
+            target = head;
+            break;
+        }
+        
+        //the least valuable block is the one displaced the most times; of those, the nearest one
+        if ( (victim == -1) || (block.counter > content[nodes[victim].way].getBlock(nodes[victim].row).counter) ) {
+            victim = head;
+        }
+        
+        //a block that would reach the threshold by moving can only be evicted
+        if ( (node.depth == searchDepth) || ((unsigned int) block.counter + 1 >= threshold) ) {
+            continue;
+        }
+        
+        for (int way = 0; way < associativity; way++) {
+            lli row = hash(block.content.addr, way);
+            
+            if ( (way != node.way) && ((int) nodes.size() < CUCKOO_SEARCH_MAX_NODES) && !onPath(head, way, row) ) {
+                nodes.push_back({way, row, head, node.depth + 1});
+            }
+            
+        }
+        
+    }
+    
+    if (target == -1) {
+        target = victim;
+    }
+    
+    path.clear();
+    
+    for (int i = target; i != -1; i = nodes[i].parent) {
+        path.push_back(i);
+    }
+    
+    //each block on the path moves one slot further, and the block in the last slot, if any, is evicted
+    for (int i = (int) path.size() - 1; i >= 0; i--) {
+        content[nodes[path[i]].way].insert(nodes[path[i]].row, carried);
+        
+        if (carried.isValid == true) {
+            carried.counter++;
+            dispAvgPerIns.value++;
+            dispAvgPerAcc.value++;
+        }
+        
+    }
+    
+    return carried.isValid;
+}
+
+bool Cuckoo::onPath(int node, int way, lli row) const {
+    
+    for (int i = node; i != -1; i = nodes[i].parent) {
+        
+        if ( (nodes[i].way == way) && (nodes[i].row == row) ) {
+            return true;
+        }
+        
+    }
+    
+    return false;
 }
 
 lli Cuckoo::getWriteBackCount() const {
@@ -81,3 +209,71 @@ lli Cuckoo::getHitCount() const {
 lli Cuckoo::getMissCount() const {
     return misses;
 }
+
+lli Cuckoo::getOccupancy(int way) const {
+    return content[way].getOccupancy();
+}
+
+void Cuckoo::save(SnapshotWriter& snapshot) const {
+    snapshot.put32(fIndex);
+    snapshot.put64(writeBackCount);
+    snapshot.put64(hits);
+    snapshot.put64(misses);
+    snapshot.put64(dispAvgPerIns.counter);
+    snapshot.put64(dispAvgPerIns.value);
+    snapshot.put64(dispAvgPerAcc.counter);
+    snapshot.put64(dispAvgPerAcc.value);
+    snapshot.put64(filterStats.lookups);
+    snapshot.put64(filterStats.positives);
+    snapshot.put64(filterStats.falsePositives);
+    
+    for (int i = 0; i < CUCKOO_PATH_LENGTHS; i++) {
+        snapshot.put64(pathLengths[i]);
+    }
+    
+    displacements.save(snapshot);
+    evictionAges.save(snapshot);
+    
+    for (int i = 0; i < associativity; i++) {
+        content[i].save(snapshot);
+    }
+    
+}
+
+void Cuckoo::load(SnapshotReader& snapshot) {
+    fIndex = snapshot.get32();
+    writeBackCount = snapshot.get64();
+    hits = snapshot.get64();
+    misses = snapshot.get64();
+    dispAvgPerIns.counter = snapshot.get64();
+    dispAvgPerIns.value = snapshot.get64();
+    dispAvgPerAcc.counter = snapshot.get64();
+    dispAvgPerAcc.value = snapshot.get64();
+    filterStats.lookups = snapshot.get64();
+    filterStats.positives = snapshot.get64();
+    filterStats.falsePositives = snapshot.get64();
+    
+    for (int i = 0; i < CUCKOO_PATH_LENGTHS; i++) {
+        pathLengths[i] = snapshot.get64();
+    }
+    
+    displacements.load(snapshot);
+    evictionAges.load(snapshot);
+    
+    filter.clear();
+    
+    //the filter is not saved; it is rebuilt from the blocks
+    for (int i = 0; i < associativity; i++) {
+        content[i].load(snapshot);
+        
+        for (lli row = 0; row < (lli) rowCount; row++) {
+            
+            if (content[i].getBlock(row).isValid) {
+                filter.add(content[i].getBlock(row).content.addr);
+            }
+            
+        }
+        
+    }
+    
+}
@@ -12,19 +12,63 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #define Cuckoo_h
 
 #include "CuckooWay.h"
+#include "CuckooHash.h"
+#include "CountingBloomFilter.h"
+#include "LogHistogram.h"
 #include <vector>
 
+#define CUCKOO_PATH_LENGTHS 17 //lengths of displacement paths counted one by one; the longer paths are counted with the last
+#define CUCKOO_SEARCH_MAX_NODES 4096 //slots a breadth-first insertion looks at, at most
+
 using namespace std;
 
 class Cuckoo {
 private:
     vector<CuckooWay> content;
+    SkewHash hash;
+    mutable vector<lli> rows; //row of the current query in every way, as computed by hash.rows()
     int blockOffset;
     unsigned int fIndex;
     lli writeBackCount;
     unsigned int threshold;
     lli hits;
     lli misses;
+    CuckooBlock carried; //the block being displaced from way to way; reused by every insertion
+    CountingBloomFilter filter; //the blocks in the ways; a lookup it rules out probes none of them
+    int searchDepth; //displacements a breadth-first insertion looks ahead, at most; 0 inserts by the round-robin walk
+    
+    /**
+     * A slot reached by the breadth-first search of an insertion
+     */
+    struct SearchNode {
+        int way;
+        lli row;
+        int parent; //node whose block would move here; -1 for the slots of the new block
+        int depth; //blocks moved to bring the new block to this slot
+    };
+    
+    vector<SearchNode> nodes; //of the current search; reused by every insertion
+    vector<int> path; //nodes from the slot freed back to the slot of the new block
+    
+    /**
+     * Place carried by the round-robin walk: each displaced block moves on to the next way until one lands in an empty place
+     * or reaches the threshold
+     * @return True if carried holds an evicted block
+     */
+    bool walk();
+    
+    /**
+     * Place carried by a breadth-first search over the slots its displacements can reach, up to searchDepth displacements;
+     * the blocks are only moved once the shortest path to an empty slot is found, or, if there is none, the path to the
+     * block displaced the most times, which is evicted
+     * @return True if carried holds an evicted block
+     */
+    bool search();
+    
+    /**
+     * @return True if the slot is on the path from node back to the new block
+     */
+    bool onPath(int node, int way, lli row) const;
     
 public:
     int rowCount;
@@ -35,10 +79,20 @@ public:
         lli value;
     } dispAvgPerIns, dispAvgPerAcc;
     
+    struct {
+        lli lookups; //calls to remove()
+        lli positives; //lookups the filter could not rule out, which probed the ways
+        lli falsePositives; //positives that missed
+    } filterStats;
+    
+    lli pathLengths[CUCKOO_PATH_LENGTHS]; //insertions by the number of blocks they displaced
+    LogHistogram displacements; //blocks displaced by each insertion, for the tail the path lengths leave out
+    LogHistogram evictionAges; //accesses to the cuckoo section each evicted block stayed for
+    
     /**
      * Constrcutor
      */
-    Cuckoo(int initRowCount, int wayCount, int initBlockOffset, vector<lli (*)(lli)> initF, unsigned int initThreshold);
+    Cuckoo(int initRowCount, int wayCount, int initBlockOffset, unsigned int initThreshold, int initSearchDepth);
     
     /**
      * Destructor; nothing to be done
@@ -46,19 +100,33 @@ public:
     ~Cuckoo();
     
     /**
-     * @return <hit?, former data>
-     * @return <true, former data> / <false, nullptr>
+     * Searches for the block and invalidates it; the ways are only probed if the filter may hold the block
+     * @return True if it was found
+     */
+    bool remove(lli addr);
+    
+    /**
+     * Insert new element with counter 0; and rotates data until reaching an empty place or reaching counter threshold,
+     * by the walk or, if searchDepth is not 0, by the breadth-first search.
+     * The displaced blocks are swapped in place with carried, so a displacement chain allocates nothing
+     * @return <true, former data> / <false, nullptr>; former data is carried, valid until the next insertion
+     */
+    pair<bool, const CuckooBlock*> insert(lli addr, const BlockValue& value);
+    
+    /**
+     * Start loading the rows of an upcoming query into the host cache
+     */
+    void prefetch(lli addr) const;
+    
+    /**
+     * Write the state to a snapshot
      */
-    pair<bool, const CuckooBlock*> remove(lli addr);
+    void save(SnapshotWriter& snapshot) const;
     
     /**
-     * Insert new element with counter 0; and rotates data until reaching an empty place or reaching counter threshold
-     * @return <dirty eviction?, former data> --> ACTIVE
-     * @return <true, nullptr> / <false, nullptr> --> DEACTIVED
-     * @return <true, former data> / <false, nullptr> --> RESULT; DELETEing former data after using it is caller's responsibility
-     ************************************************************************************************************************************
+     * Read the state back from a snapshot into a cuckoo just constructed with the same geometry
      */
-    pair<bool, const CuckooBlock*> insert(lli addr, string value);
+    void load(SnapshotReader& snapshot);
     
     /**
      * @return writeBackCount
@@ -74,6 +142,11 @@ public:
      * @return missCount
      */
     lli getMissCount() const;
+    
+    /**
+     * @return Number of valid blocks in a way
+     */
+    lli getOccupancy(int way) const;
 };
 
 #endif /* Cuckoo_h */
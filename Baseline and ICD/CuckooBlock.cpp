@@ -9,39 +9,39 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 */
 
 #include "CuckooBlock.h"
+#include <utility>
 
-CuckooBlock::CuckooBlock(int initBlockOffset): Block(initBlockOffset), counter(0), former(nullptr) {
+using namespace std;
+
+CuckooBlock::CuckooBlock(int initBlockOffset): Block(initBlockOffset), counter(0), insertedAt(0) {
 }
 
-CuckooBlock::CuckooBlock(const CuckooBlock& src): Block(src), counter(src.counter), former(nullptr) {
+CuckooBlock::CuckooBlock(const CuckooBlock& src): Block(src), counter(src.counter), insertedAt(src.insertedAt) {
     
 }
 
 CuckooBlock::~CuckooBlock() {
     
-    if (former != nullptr) {
-        delete former;
-    }
-    
 }
 
-const CuckooBlock* CuckooBlock::set(lli newAddr, int newCounter, std::string value) {
-    
-    if (former != nullptr) {
-        delete former;
-    }
-    
-    former = new CuckooBlock(*this);
+void CuckooBlock::set(lli newAddr, int newCounter, lli newInsertedAt, const BlockValue& value) {
     content.addr = newAddr;
     content.value = value;
     counter = newCounter;
+    insertedAt = newInsertedAt;
     isValid = true;
-    return former;
+}
+
+void CuckooBlock::exchange(CuckooSlot& slot) {
+    swap(content, slot.content);
+    swap(counter, slot.counter);
+    swap(insertedAt, slot.insertedAt);
+    swap(isValid, slot.isValid);
 }
 
 CuckooBlock CuckooBlock::operator=(const CuckooBlock &right) {
     counter = right.counter;
-    former = nullptr;
+    insertedAt = right.insertedAt;
     Block::operator=(right);
     return (*this);
-}
\ No newline at end of file
+}
@@ -13,11 +13,21 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 #include "Block.h"
 
+/**
+ * A block as a way stores it: the state of a CuckooBlock as plain fields, so that an empty row is all bytes zero
+ */
+struct CuckooSlot {
+    BlockContent content;
+    lli insertedAt;
+    int counter;
+    bool isValid;
+};
+
 class CuckooBlock: public Block {
 friend class Cuckoo;
 protected:
     int counter;
-    CuckooBlock* former;
+    lli insertedAt; //accesses to the cuckoo section before the block was inserted; its age is counted from there
 
 public:
     /**
@@ -33,14 +43,19 @@ public:
     CuckooBlock(const CuckooBlock& src);
     
     /**
-     * Destructor; delete former in case
+     * Destructor; nothing to be done
      */
     virtual ~CuckooBlock();
     
     /**
-     * @return Former data
+     * Overwrite the block with a valid one
+     */
+    void set(lli newAddr, int newCounter, lli newInsertedAt, const BlockValue& value);
+    
+    /**
+     * Swap the contents, the counters, the insertion times and the valid bits of the block and a row in place
      */
-    const CuckooBlock* set(lli newAddr, int newCounter, std::string value);
+    void exchange(CuckooSlot& slot);
     
     /**
      * copy everything to this object
@@ -0,0 +1,145 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef CuckooHash_h
+#define CuckooHash_h
+
+#include "Block.h"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#define SKEW_HASH_WAY_STEP 144 //way w hashes the block address plus w times this
+
+using namespace std;
+
+/**
+ * The skewed hash functions of the ways of the cuckoo section, which supports any number of ways: way w maps a block
+ * to a shift/add/xor mix of its address plus SKEW_HASH_WAY_STEP * w, modulo the row count.
+ * It is a plain type rather than a table of function pointers, so the hashes are inlined into the cuckoo section;
+ * rows() computes the rows of all the ways at once, 8 ways per step with AVX-512 and 4 with AVX2
+ */
+class SkewHash {
+private:
+    uint64_t rowMask; //the row count is a power of two
+    
+    static inline uint64_t mix(uint64_t key) {
+        key += (key << 12);
+        key ^= (key >> 22);
+        key += (key << 4);
+        key ^= (key >> 9);
+        key += (key << 10);
+        key ^= (key >> 2);
+        key += (key << 7);
+        key ^= (key >> 12);
+        return key;
+    }
+    
+#if defined(__AVX512F__)
+    static inline __m512i mix(__m512i key) {
+        key = _mm512_add_epi64(key, _mm512_slli_epi64(key, 12));
+        key = _mm512_xor_si512(key, _mm512_srli_epi64(key, 22));
+        key = _mm512_add_epi64(key, _mm512_slli_epi64(key, 4));
+        key = _mm512_xor_si512(key, _mm512_srli_epi64(key, 9));
+        key = _mm512_add_epi64(key, _mm512_slli_epi64(key, 10));
+        key = _mm512_xor_si512(key, _mm512_srli_epi64(key, 2));
+        key = _mm512_add_epi64(key, _mm512_slli_epi64(key, 7));
+        key = _mm512_xor_si512(key, _mm512_srli_epi64(key, 12));
+        return key;
+    }
+#elif defined(__AVX2__)
+    static inline __m256i mix(__m256i key) {
+        key = _mm256_add_epi64(key, _mm256_slli_epi64(key, 12));
+        key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 22));
+        key = _mm256_add_epi64(key, _mm256_slli_epi64(key, 4));
+        key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 9));
+        key = _mm256_add_epi64(key, _mm256_slli_epi64(key, 10));
+        key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 2));
+        key = _mm256_add_epi64(key, _mm256_slli_epi64(key, 7));
+        key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 12));
+        return key;
+    }
+#endif
+    
+    /**
+     * @return The block address the ways hash; the address is shifted as a signed number
+     */
+    static inline uint64_t blockOf(lli addr) {
+        return (uint64_t) ((int64_t) addr >> 6);
+    }
+    
+public:
+    /**
+     * Number of entries rows() may write: the way count rounded up to a whole number of SIMD steps
+     */
+    static constexpr int rowBufferSize(int wayCount) {
+        return (wayCount + 7) / 8 * 8;
+    }
+    
+    /**
+     * Constructor
+     * @param rowCount Rows of every way; a power of two
+     */
+    SkewHash(int rowCount): rowMask((uint64_t) rowCount - 1) {
+        
+        if ( (rowCount < 1) || ((rowCount & (rowCount - 1)) != 0) ) {
+            cout << "Cuckoo Row Count Must Be A Power Of Two\n";
+            exit(EXIT_FAILURE);
+        }
+        
+    }
+    
+    /**
+     * @return Row of the block of addr in a way
+     */
+    inline lli operator()(lli addr, unsigned int way) const {
+        return mix(blockOf(addr) + way * SKEW_HASH_WAY_STEP) & rowMask;
+    }
+    
+    /**
+     * Compute the row of the block of addr in every way
+     * @param rows Receives the row of way w at rows[w]; rowBufferSize(wayCount) entries are written
+     */
+    inline void rows(lli addr, int wayCount, lli* rows) const {
+        uint64_t block = blockOf(addr);
+        
+#if defined(__AVX512F__)
+        __m512i mask = _mm512_set1_epi64(rowMask);
+        __m512i step = _mm512_set1_epi64(8 * SKEW_HASH_WAY_STEP);
+        __m512i keys = _mm512_add_epi64(_mm512_set1_epi64(block), _mm512_setr_epi64(0, SKEW_HASH_WAY_STEP, 2 * SKEW_HASH_WAY_STEP, 3 * SKEW_HASH_WAY_STEP, 4 * SKEW_HASH_WAY_STEP, 5 * SKEW_HASH_WAY_STEP, 6 * SKEW_HASH_WAY_STEP, 7 * SKEW_HASH_WAY_STEP));
+        
+        for (int way = 0; way < wayCount; way += 8) {
+            _mm512_storeu_si512((void*) (rows + way), _mm512_and_si512(mix(keys), mask));
+            keys = _mm512_add_epi64(keys, step);
+        }
+#elif defined(__AVX2__)
+        __m256i mask = _mm256_set1_epi64x(rowMask);
+        __m256i step = _mm256_set1_epi64x(4 * SKEW_HASH_WAY_STEP);
+        __m256i keys = _mm256_add_epi64(_mm256_set1_epi64x(block), _mm256_setr_epi64x(0, SKEW_HASH_WAY_STEP, 2 * SKEW_HASH_WAY_STEP, 3 * SKEW_HASH_WAY_STEP));
+        
+        for (int way = 0; way < wayCount; way += 4) {
+            _mm256_storeu_si256((__m256i*) (rows + way), _mm256_and_si256(mix(keys), mask));
+            keys = _mm256_add_epi64(keys, step);
+        }
+#else
+        for (int way = 0; way < wayCount; way++) {
+            rows[way] = mix(block + way * SKEW_HASH_WAY_STEP) & rowMask;
+        }
+#endif
+    }
+};
+
+#endif /* CuckooHash_h */
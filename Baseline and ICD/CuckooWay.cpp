@@ -10,35 +10,90 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 #include "CuckooWay.h"
 #include <iostream>
+#include <cstdlib>
 
-CuckooWay::CuckooWay(int initRowCount, lli (*hashFunction)(lli addr), int initBlockOffset): rowCount(initRowCount), blockOffset(initBlockOffset), hash(hashFunction), content(initRowCount, CuckooBlock(initBlockOffset)), former(nullptr) {
+CuckooWay::CuckooWay(int initRowCount, int initBlockOffset): rowCount(initRowCount), blockOffset(initBlockOffset), content(initRowCount), occupancy(0) {
     
 }
 
 CuckooWay::~CuckooWay() {
     
-    if (former != nullptr) {
-        delete former;
+}
+
+void CuckooWay::insert(lli row, CuckooBlock& carried) {
+    occupancy += carried.getValid();
+    carried.exchange(content[row]);
+    occupancy -= carried.getValid();
+}
+
+bool CuckooWay::remove(lli row, lli query) {
+    CuckooSlot& elem = content[row];
+    int shiftCount = blockOffset + 2; //as in Block, the byte offset is ignored too
+    
+    if ( (!elem.isValid) || ((elem.content.addr >> shiftCount) != (query >> shiftCount)) ) {
+        return false;
     }
     
+    elem.isValid = false;
+    occupancy--;
+    return true;
+}
+
+void CuckooWay::prefetch(lli row) const {
+    __builtin_prefetch(&content[row], 1);
+}
+
+const CuckooSlot& CuckooWay::getBlock(lli row) const {
+    return content[row];
 }
 
-const CuckooBlock* CuckooWay::insert(lli newAddr, int counter, string value) {
-    return content.at(hash(newAddr)).set(newAddr, counter, value);
+lli CuckooWay::getOccupancy() const {
+    return occupancy;
 }
 
-pair<bool, const CuckooBlock*> CuckooWay::remove(lli query) {
-    CuckooBlock& elem = content.at(hash(query));
+void CuckooWay::save(SnapshotWriter& snapshot) const {
+    lli validRows = 0;
     
-    if (elem != query) {
-        return make_pair(false, nullptr);
+    for (int i = 0; i < rowCount; i++) {
+        validRows += content[i].isValid;
     }
     
-    if (former != nullptr) {
-        delete former;
+    snapshot.put64(validRows);
+    
+    for (int i = 0; i < rowCount; i++) {
+        
+        if (content[i].isValid) {
+            const CuckooSlot& slot = content[i];
+            snapshot.put32(i);
+            snapshot.put64(slot.content.addr);
+            snapshot.put32(slot.counter);
+            snapshot.put64(slot.insertedAt);
+            snapshot.putValue(slot.content.value);
+        }
+        
+    }
+    
+}
+
+void CuckooWay::load(SnapshotReader& snapshot) {
+    lli validRows = snapshot.get64();
+    
+    for (lli i = 0; i < validRows; i++) {
+        uint32_t row = snapshot.get32();
+        
+        if (row >= (uint32_t) rowCount) {
+            cout << "Snapshot Is Corrupted\n";
+            exit(EXIT_FAILURE);
+        }
+        
+        CuckooSlot& slot = content[row];
+        slot.content.addr = snapshot.get64();
+        slot.counter = snapshot.get32();
+        slot.insertedAt = snapshot.get64();
+        snapshot.getValue(slot.content.value);
+        slot.isValid = true;
     }
     
-    former = new CuckooBlock(elem);
-    elem.evict();
-    return make_pair(true, former);
-}
\ No newline at end of file
+    occupancy = validRows;
+    
+}
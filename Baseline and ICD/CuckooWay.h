@@ -12,7 +12,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #define CuckooWay_h
 
 #include "CuckooBlock.h"
-#include <vector>
+#include "LazyArray.h"
+#include "Snapshot.h"
 
 using namespace std;
 
@@ -20,34 +21,63 @@ class CuckooWay {
 private:
     int rowCount;
     int blockOffset;
-    vector<CuckooBlock> content;
-    lli (*hash)(lli addr);
-    CuckooBlock* former;
+    LazyArray<CuckooSlot> content; //a row is backed on first touch, so a large and mostly empty way costs little
+    lli occupancy; //valid blocks
     
 public:
     
     /**
-     * Constructor
+     * Constructor; the rows of the blocks are given by the hash of the way (see SkewHash), which Cuckoo computes
      * @param initBlockOffset Number of rightmost bits ignored for each block
      */
-    CuckooWay(int initRowCount, lli (*hashFunction)(lli addr), int initBlockOffset);
+    CuckooWay(int initRowCount, int initBlockOffset);
     
     /**
-     * Destructor; delete former in case
+     * Move constructor; the rows are handed over, not copied
+     */
+    CuckooWay(CuckooWay&& src) = default;
+    
+    /**
+     * Destructor; nothing to be done
      */
     ~CuckooWay();
     
     /**
-     * Insert the new block into the cuckoo
-     * @return Former data on the block being replaced
+     * Insert a block into a row by swapping it with the block there; nothing is allocated or copied
+     * @param carried The block to insert; holds the block it replaced afterwards, which is invalid if the row was empty
+     */
+    void insert(lli row, CuckooBlock& carried);
+    
+    /**
+     * Searches a row for the query and invalidates it in place
+     * @return True if it was found
+     */
+    bool remove(lli row, lli query);
+    
+    /**
+     * Start loading a row into the host cache
+     */
+    void prefetch(lli row) const;
+    
+    /**
+     * @return The block in a row, valid or not
+     */
+    const CuckooSlot& getBlock(lli row) const;
+    
+    /**
+     * @return Number of valid blocks
+     */
+    lli getOccupancy() const;
+    
+    /**
+     * Write the state to a snapshot; only the valid rows are written
      */
-    const CuckooBlock* insert(lli newAddr, int counter, string value);
+    void save(SnapshotWriter& snapshot) const;
     
     /**
-     * Searches for the query and deletes it
-     * @return The element begin deleted
+     * Read the state back from a snapshot into a way just constructed with the same geometry
      */
-    pair<bool, const CuckooBlock*> remove(lli query);
+    void load(SnapshotReader& snapshot);
 };
 
 #endif /* CuckooWay_h */
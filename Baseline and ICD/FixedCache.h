@@ -0,0 +1,92 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef FixedCache_h
+#define FixedCache_h
+
+#include "Cache.h"
+
+/**
+ * A Cache whose geometry is fixed at compile time, so that the set index is a mask and the loops over the ways
+ * of a set have constant bounds; the statistics and the storage are those of Cache
+ */
+template<int Sets, int Ways, int BlockBytes>
+class FixedCache: public Cache {
+    static_assert( (Sets > 0) && ((Sets & (Sets - 1)) == 0), "set count must be a power of two");
+    static_assert( (Ways > 0) && (Ways <= CACHE_SET_MAX_WAYS), "associativity must be between 1 and CACHE_SET_MAX_WAYS");
+    static_assert( (BlockBytes >= 4) && ((BlockBytes & (BlockBytes - 1)) == 0), "block size must be a power of two");
+    
+    static constexpr int log2(int x) {
+        return (x <= 1) ? 0 : 1 + log2(x / 2);
+    }
+    
+public:
+    /**
+     * Constructor; takes the arguments of Cache, which must describe the same geometry as the template
+     */
+    FixedCache(int setCount, int initAssociativity, int initBlockOffset, int initIndexSize): Cache(setCount, initAssociativity, initBlockOffset, initIndexSize) {
+        
+        if ( (setCount != Sets) || (initAssociativity != Ways) || (initBlockOffset + 2 != log2(BlockBytes)) || (initIndexSize != log2(Sets)) ) {
+            cout << "Cache Geometry Does Not Match FixedCache\n";
+            exit(EXIT_FAILURE);
+        }
+        
+    }
+    
+    /**
+     * @return pair<hit?, former data>; former data is meaningless on a hit
+     */
+    pair<bool, Victim> request(lli queryAddr, bool queryDirty, bool affectReadHitRatio, const BlockValue& value) {
+        lli setIndex = (queryAddr >> log2(BlockBytes)) & (Sets - 1);
+        return account(CacheSet(*this, setIndex).request<Ways>(queryAddr, queryDirty, value), affectReadHitRatio);
+    }
+    
+    /**
+     * Send a query without its value (see Cache::warm())
+     */
+    pair<bool, Victim> warm(lli queryAddr, bool queryDirty, bool affectReadHitRatio) {
+        lli setIndex = (queryAddr >> log2(BlockBytes)) & (Sets - 1);
+        return account(CacheSet(*this, setIndex).request<Ways, false>(queryAddr, queryDirty, BlockValue()), affectReadHitRatio);
+    }
+    
+    /**
+     * Start loading the set of an upcoming query into the host cache
+     */
+    void prefetch(lli queryAddr) const {
+        prefetchSet((queryAddr >> log2(BlockBytes)) & (Sets - 1));
+    }
+};
+
+/**
+ * The cache to simulate a geometry with; FixedCache for the geometries CacheSet.cpp instantiates, and Cache otherwise
+ */
+template<int CacheKiB, int Ways, int BlockBytes>
+struct CacheFor {
+    typedef Cache type;
+};
+
+template<>
+struct CacheFor<512, 4, 64> {
+    typedef FixedCache<2048, 4, 64> type;
+};
+
+template<>
+struct CacheFor<2048, 16, 64> {
+    typedef FixedCache<2048, 16, 64> type;
+};
+
+template<>
+struct CacheFor<8192, 16, 64> {
+    typedef FixedCache<8192, 16, 64> type;
+};
+
+#endif /* FixedCache_h */
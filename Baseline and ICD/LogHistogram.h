@@ -0,0 +1,167 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef LogHistogram_h
+#define LogHistogram_h
+
+#include "Block.h"
+#include "Snapshot.h"
+#include <cstdint>
+
+#define LOG_HISTOGRAM_BUCKETS 65 //bucket 0 counts the zeros and bucket b the values from 2^(b-1) to 2^b - 1
+
+/**
+ * A histogram of non-negative counts in buckets of powers of two. Recording a value is one increment in a fixed
+ * array, so it can stay on the hot path; the percentiles it gives are the upper ends of the buckets they fall in
+ */
+class LogHistogram {
+private:
+    lli counts[LOG_HISTOGRAM_BUCKETS];
+    lli total;
+    lli maximum;
+    
+public:
+    /**
+     * Constructor; the histogram is empty
+     */
+    LogHistogram() {
+        clear();
+    }
+    
+    /**
+     * @return The bucket of value
+     */
+    static inline int bucketOf(lli value) {
+        return (value <= 0) ? 0 : 64 - __builtin_clzll(value);
+    }
+    
+    /**
+     * @return The largest value of a bucket
+     */
+    static inline lli upperEnd(int bucket) {
+        return (bucket == 0) ? 0 : (bucket == LOG_HISTOGRAM_BUCKETS - 1) ? INT64_MAX : (1LL << bucket) - 1;
+    }
+    
+    /**
+     * Count one more value
+     */
+    inline void add(lli value) {
+        counts[bucketOf(value)]++;
+        total++;
+        
+        if (value > maximum) {
+            maximum = value;
+        }
+        
+    }
+    
+    /**
+     * Keep only the values counted after earlier, a former copy of this histogram; the maximum becomes the upper end of
+     * the highest bucket left, or the maximum of this histogram if that is lower
+     */
+    void subtract(const LogHistogram& earlier) {
+        total -= earlier.total;
+        int highest = 0;
+        
+        for (int i = 0; i < LOG_HISTOGRAM_BUCKETS; i++) {
+            counts[i] -= earlier.counts[i];
+            
+            if (counts[i] != 0) {
+                highest = i;
+            }
+            
+        }
+        
+        maximum = (upperEnd(highest) < maximum) ? upperEnd(highest) : maximum;
+    }
+    
+    /**
+     * @return An upper bound of the value below which a fraction q of the values fall; 0 if there is none
+     */
+    lli percentile(double q) const {
+        lli rank = (lli) (q * total);
+        lli seen = 0;
+        
+        for (int i = 0; i < LOG_HISTOGRAM_BUCKETS; i++) {
+            seen += counts[i];
+            
+            if (seen > rank) {
+                return (upperEnd(i) < maximum) ? upperEnd(i) : maximum;
+            }
+            
+        }
+        
+        return maximum;
+    }
+    
+    /**
+     * @return The count of a bucket
+     */
+    lli getCount(int bucket) const {
+        return counts[bucket];
+    }
+    
+    /**
+     * @return Number of values counted
+     */
+    lli getTotal() const {
+        return total;
+    }
+    
+    /**
+     * @return The largest value counted
+     */
+    lli getMax() const {
+        return maximum;
+    }
+    
+    /**
+     * Forget every value
+     */
+    void clear() {
+        
+        for (int i = 0; i < LOG_HISTOGRAM_BUCKETS; i++) {
+            counts[i] = 0;
+        }
+        
+        total = 0;
+        maximum = 0;
+    }
+    
+    /**
+     * Write the state to a snapshot
+     */
+    void save(SnapshotWriter& snapshot) const {
+        
+        for (int i = 0; i < LOG_HISTOGRAM_BUCKETS; i++) {
+            snapshot.put64(counts[i]);
+        }
+        
+        snapshot.put64(total);
+        snapshot.put64(maximum);
+    }
+    
+    /**
+     * Read the state back from a snapshot
+     */
+    void load(SnapshotReader& snapshot) {
+        
+        for (int i = 0; i < LOG_HISTOGRAM_BUCKETS; i++) {
+            counts[i] = snapshot.get64();
+        }
+        
+        total = snapshot.get64();
+        maximum = snapshot.get64();
+    }
+};
+
+#endif /* LogHistogram_h */
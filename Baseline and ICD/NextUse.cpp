@@ -0,0 +1,188 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "NextUse.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+/**
+ * The last use of every block seen so far in the backward pass; open addressing with linear probing, as the
+ * footprint of a long trace makes a node per block too costly
+ */
+class LastUseTable {
+private:
+    vector<uint64_t> keys; //block + 1; 0 is an empty slot
+    vector<uint64_t> uses;
+    uint64_t mask;
+    uint64_t count;
+    
+    size_t slotOf(uint64_t key) const {
+        size_t slot = (size_t) ((key * 0x9e3779b97f4a7c15ULL) >> 32) & mask;
+        
+        while ( (keys[slot] != 0) && (keys[slot] != key) ) {
+            slot = (slot + 1) & mask;
+        }
+        
+        return slot;
+    }
+    
+    void grow() {
+        vector<uint64_t> oldKeys;
+        vector<uint64_t> oldUses;
+        oldKeys.swap(keys);
+        oldUses.swap(uses);
+        keys.assign(2 * oldKeys.size(), 0);
+        uses.assign(2 * oldUses.size(), 0);
+        mask = keys.size() - 1;
+        
+        for (size_t i = 0; i < oldKeys.size(); i++) {
+            
+            if (oldKeys[i] != 0) {
+                size_t slot = slotOf(oldKeys[i]);
+                keys[slot] = oldKeys[i];
+                uses[slot] = oldUses[i];
+            }
+            
+        }
+        
+    }
+    
+public:
+    LastUseTable(): keys(1 << 16, 0), uses(1 << 16, 0), mask((1 << 16) - 1), count(0) {
+        
+    }
+    
+    /**
+     * Record a use of a block
+     * @return The use of the block recorded before, or NEXT_USE_NEVER
+     */
+    uint64_t exchange(uint64_t block, uint64_t use) {
+        size_t slot = slotOf(block + 1);
+        
+        if (keys[slot] != 0) {
+            uint64_t former = uses[slot];
+            uses[slot] = use;
+            return former;
+        }
+        
+        keys[slot] = block + 1;
+        uses[slot] = use;
+        count++;
+        
+        //kept at most half full, so that the probes stay short
+        if (2 * count > keys.size()) {
+            grow();
+        }
+        
+        return NEXT_USE_NEVER;
+    }
+};
+
+static void scratchFailed() {
+    cout << "Scratch File Cannot Be Written\n";
+    exit(EXIT_FAILURE);
+}
+
+NextUse::NextUse(TraceReader* trace, int bitsBeforeIndex): block(NEXT_USE_BLOCK_QUERIES), position(0), loaded(0), queryCount(0) {
+    const char* directory = getenv("TMPDIR");
+    string path = string(((directory != nullptr) && (*directory != '\0')) ? directory : "/tmp") + "/next-use-XXXXXX";
+    int fd = mkstemp(&path[0]);
+    
+    if (fd < 0) {
+        scratchFailed();
+    }
+    
+    unlink(path.c_str());
+    file = fdopen(fd, "w+b");
+    
+    if (file == nullptr) {
+        scratchFailed();
+    }
+    
+    
+    //forward: the block address of every query
+    TraceRecord record;
+    size_t filled = 0;
+    
+    while (trace->next(record)) {
+        
+        if (record.type == TRACE_UPGRADE) {
+            continue; //ignore Upgrade
+        }
+        
+        block[filled++] = record.addr >> bitsBeforeIndex;
+        queryCount++;
+        
+        if ( (filled == block.size()) && (fwrite(block.data(), sizeof(uint64_t), filled, file) != filled) ) {
+            scratchFailed();
+        }
+        
+        filled %= block.size();
+    }
+    
+    if ( (fwrite(block.data(), sizeof(uint64_t), filled, file) != filled) || (fflush(file) != 0) ) {
+        scratchFailed();
+    }
+    
+    //backward: every address is replaced by the next use of its block, block by block from the end
+    LastUseTable lastUse;
+    
+    uint64_t end = queryCount;
+    
+    while (end > 0) {
+        uint64_t first = (end - 1) / block.size() * block.size();
+        size_t bytes = (size_t) (end - first) * sizeof(uint64_t);
+        
+        if (pread(fd, block.data(), bytes, first * sizeof(uint64_t)) != (ssize_t) bytes) {
+            scratchFailed();
+        }
+        
+        for (size_t i = (size_t) (end - first); i-- > 0;) {
+            block[i] = lastUse.exchange(block[i], first + i);
+        }
+        
+        if (pwrite(fd, block.data(), bytes, first * sizeof(uint64_t)) != (ssize_t) bytes) {
+            scratchFailed();
+        }
+        
+        end = first;
+    }
+    
+    rewind(file); //the stream did no I/O of its own since the flush, so it reads what pwrite() left
+}
+
+NextUse::~NextUse() {
+    fclose(file);
+}
+
+uint64_t NextUse::next() {
+    
+    if (position == loaded) {
+        loaded = fread(block.data(), sizeof(uint64_t), block.size(), file);
+        position = 0;
+        
+        if (loaded == 0) {
+            cout << "Scratch File Is Truncated\n";
+            exit(EXIT_FAILURE);
+        }
+        
+    }
+    
+    return block[position++];
+}
+
+uint64_t NextUse::getQueryCount() const {
+    return queryCount;
+}
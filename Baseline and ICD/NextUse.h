@@ -0,0 +1,66 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef NextUse_h
+#define NextUse_h
+
+#include "Block.h"
+#include "TraceReader.h"
+#include <cstdio>
+#include <vector>
+
+#define NEXT_USE_NEVER UINT64_MAX //the block is not queried again
+#define NEXT_USE_BLOCK_QUERIES (1 << 20) //queries read or written to the scratch file at once
+
+using namespace std;
+
+/**
+ * The next use of every query of a trace: the number of the next query to the same block, queries being numbered
+ * from 0 in trace order and upgrades not being queries. The block addresses are spilled to a scratch file in one
+ * forward pass over the trace, then overwritten in place by their next uses in a backward pass over that file, so
+ * that only one block of queries and one entry per distinct block are held in memory however long the trace is.
+ * The scratch file is created in $TMPDIR, or /tmp, and unlinked at once
+ */
+class NextUse {
+private:
+    FILE* file;
+    vector<uint64_t> block;
+    size_t position; //of the next query in block
+    size_t loaded; //queries in block
+    uint64_t queryCount;
+    
+public:
+    /**
+     * Constructor; reads the whole trace
+     * @param bitsBeforeIndex Number of rightmost bits of an address that are not part of its block, as for Cache
+     */
+    NextUse(TraceReader* trace, int bitsBeforeIndex);
+    
+    NextUse(const NextUse&) = delete;
+    
+    /**
+     * Destructor; closes the scratch file
+     */
+    ~NextUse();
+    
+    /**
+     * @return Next use of the next query, or NEXT_USE_NEVER; the queries are taken in trace order
+     */
+    uint64_t next();
+    
+    /**
+     * @return Number of queries of the trace
+     */
+    uint64_t getQueryCount() const;
+};
+
+#endif /* NextUse_h */
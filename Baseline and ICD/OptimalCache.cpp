@@ -0,0 +1,86 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "OptimalCache.h"
+
+OptimalCache::OptimalCache(int setCount, int initAssociativity, int initBlockOffset, int initIndexSize, bool initWriteAware): Cache(setCount, initAssociativity, initBlockOffset, initIndexSize), nextUseArr((size_t) setCount * initAssociativity), writeAware(initWriteAware) {
+    
+}
+
+int OptimalCache::victimOf(const uint64_t* nextUseRow, uint64_t dirty) const {
+    int victim = -1;
+    
+    for (int way = 0; way < associativity; way++) {
+        
+        if ( writeAware && (((dirty >> way) & 1) != 0) ) {
+            continue;
+        }
+        
+        //of the blocks used again equally late, typically never, a clean one is evicted, which costs no extra miss
+        if ( (victim < 0) || (nextUseRow[way] > nextUseRow[victim]) || ((nextUseRow[way] == nextUseRow[victim]) && (((dirty >> victim) & ~(dirty >> way) & 1) != 0)) ) {
+            victim = way;
+        }
+        
+    }
+    
+    //every block is dirty; the write-aware oracle falls back to MIN
+    if (victim < 0) {
+        victim = 0;
+        
+        for (int way = 1; way < associativity; way++) {
+            
+            if (nextUseRow[way] > nextUseRow[victim]) {
+                victim = way;
+            }
+            
+        }
+        
+    }
+    
+    return victim;
+}
+
+pair<bool, Victim> OptimalCache::request(lli queryAddr, bool queryDirty, bool affectReadHitRatio, uint64_t nextUse) {
+    lli setIndex = setOf(queryAddr);
+    lli* addrRow = &addrArr[setIndex * rowWays];
+    uint64_t* nextUseRow = &nextUseArr[setIndex * associativity];
+    uint64_t& valid = validArr[setIndex];
+    uint64_t& dirty = dirtyArr[setIndex];
+    lli query = queryAddr & blockMask;
+    
+    for (int way = 0; way < associativity; way++) {
+        
+        if ( (((valid >> way) & 1) != 0) && ((addrRow[way] & blockMask) == query) ) { //if hit
+            nextUseRow[way] = nextUse;
+            
+            if (queryDirty) {
+                dirty |= 1ULL << way;
+            }
+            
+            return account(make_pair(true, Victim()), affectReadHitRatio);
+        }
+        
+    }
+    
+    //miss; the empty ways are filled in order
+    const uint64_t fullMask = (associativity == 64) ? ~0ULL : ((1ULL << associativity) - 1);
+    int way = (valid != fullMask) ? __builtin_ctzll(~valid) : victimOf(nextUseRow, dirty);
+    uint64_t bit = 1ULL << way;
+    Victim former;
+    former.dirty = (valid & dirty & bit) != 0;
+    former.content.addr = addrRow[way];
+    addrRow[way] = queryAddr;
+    nextUseRow[way] = nextUse;
+    valid |= bit;
+    dirty = queryDirty ? (dirty | bit) : (dirty & ~bit);
+    return account(make_pair(false, former), affectReadHitRatio);
+}
@@ -0,0 +1,52 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef OptimalCache_h
+#define OptimalCache_h
+
+#include "Cache.h"
+
+/**
+ * An offline replacement oracle with the geometry and the statistics of Cache, giving the bounds the online policies
+ * are judged against. Every query is sent with its next use (see NextUse). A miss is always filled, as in Cache.
+ *
+ * Without writeAware, the victim is the block used again farthest in the future, which is Belady's MIN and gives the
+ * fewest misses; ties, mostly blocks never used again, go to a clean block. With writeAware, the victim is the clean
+ * block used again farthest in the future, and a dirty block is only evicted when the whole set is dirty; a dirty
+ * block kept longer is more likely to absorb the next dirty eviction of the L1 and to be written back once. This is
+ * a heuristic rather than a bound: another policy may write back less, and it pays for its write-backs with misses
+ */
+class OptimalCache: public Cache {
+private:
+    LazyArray<uint64_t> nextUseArr; //next use of the block in each way, at [s * associativity + w]
+    bool writeAware;
+    
+    /**
+     * @return The way to fill in a full set
+     */
+    int victimOf(const uint64_t* nextUseRow, uint64_t dirty) const;
+    
+public:
+    /**
+     * Constructor; the geometry is that of Cache
+     * @param initWriteAware Favour clean victims over the fewest misses
+     */
+    OptimalCache(int setCount, int initAssociativity, int initBlockOffset, int initIndexSize, bool initWriteAware);
+    
+    /**
+     * @param nextUse Next use of the block of queryAddr, after this query
+     * @return pair<hit?, former data>; former data is meaningless on a hit, and carries no value
+     */
+    pair<bool, Victim> request(lli queryAddr, bool queryDirty, bool affectReadHitRatio, uint64_t nextUse);
+};
+
+#endif /* OptimalCache_h */
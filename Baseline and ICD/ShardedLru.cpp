@@ -0,0 +1,296 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "ShardedLru.h"
+#include <iostream>
+#include <cstdlib>
+
+ShardedLru::ShardedLru(int setCount, int associativity, int blockOffset, int indexSize, int initShardCount, ostream* initTimeTraceOut, long double initClkStep, bool initCountExact2WBs): shardCount(initShardCount), setMask(setCount - 1), bitsBeforeIndex(blockOffset + 2), timeTrace(initTimeTraceOut != nullptr), countExact2WBs(initCountExact2WBs), timer(0), clkStep(initClkStep), timeTraceOut(initTimeTraceOut), shards(initShardCount), published(0), pending(0), finished(false) {
+    
+    if ( (shardCount < 1) || ((shardCount & (shardCount - 1)) != 0) || (shardCount > setCount) || (shardCount > 65536) ) {
+        cout << "Thread Count Must Be A Power Of Two Not Above The Set Count\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    int shardBits = 0;
+    
+    while ((1 << shardBits) < shardCount) {
+        shardBits++;
+    }
+    
+    shardShift = indexSize - shardBits;
+    
+    for (int i = 0; i < shardCount; i++) {
+        shards[i].cache = new Cache(setCount / shardCount, associativity, blockOffset, indexSize - shardBits); //indexes by the remaining low bits
+        shards[i].timeTrace << fixed;
+    }
+    
+    for (int i = 0; i < 2; i++) {
+        chunks[i].records.resize(SHARD_CHUNK_RECORDS);
+        chunks[i].timers.resize(timeTrace ? SHARD_CHUNK_RECORDS : 0);
+        chunks[i].shardOf.resize(SHARD_CHUNK_RECORDS);
+        chunks[i].shardRecords.resize(shardCount);
+        chunks[i].count = 0;
+    }
+    
+    for (int i = 0; i < shardCount; i++) {
+        workers.push_back(thread(&ShardedLru::work, this, i));
+    }
+    
+}
+
+ShardedLru::~ShardedLru() {
+    {
+        lock_guard<mutex> guard(lock);
+        finished = true;
+    }
+    
+    wake.notify_all();
+    
+    for (int i = 0; i < shardCount; i++) {
+        workers[i].join();
+        delete shards[i].cache;
+    }
+    
+}
+
+bool ShardedLru::fill(TraceReader* trace, Chunk& chunk) {
+    chunk.count = 0;
+    
+    for (int i = 0; i < shardCount; i++) {
+        chunk.shardRecords[i].clear();
+    }
+    
+    while (chunk.count < SHARD_CHUNK_RECORDS) {
+        TraceRecord& record = chunk.records[chunk.count];
+        
+        if (!trace->next(record)) {
+            return false;
+        }
+        
+        if (record.type == TRACE_UPGRADE) {
+            continue; //ignore Upgrade
+        }
+        
+        if (timeTrace) {
+            chunk.timers[chunk.count] = timer;
+            
+            if ( (record.type == TRACE_READ) || (record.type == TRACE_WRITE) ) {
+                timer += clkStep;
+            }
+            
+        }
+        
+        int shard = (int) ((((lli) record.addr >> bitsBeforeIndex) & setMask) >> shardShift);
+        chunk.shardOf[chunk.count] = (uint16_t) shard;
+        chunk.shardRecords[shard].push_back((uint32_t) chunk.count);
+        chunk.count++;
+    }
+    
+    return true;
+}
+
+void ShardedLru::work(int shard) {
+    uint64_t next = 0;
+    
+    while (true) {
+        {
+            unique_lock<mutex> guard(lock);
+            wake.wait(guard, [&] { return (published > next) || finished; });
+            
+            if (published <= next) {
+                return;
+            }
+            
+        }
+        
+        simulate(chunks[next % 2], shard);
+        next++;
+        
+        {
+            lock_guard<mutex> guard(lock);
+            
+            if (--pending == 0) {
+                done.notify_one();
+            }
+            
+        }
+        
+    }
+    
+}
+
+void ShardedLru::simulate(Chunk& chunk, int shard) {
+    Shard& owner = shards[shard];
+    const vector<uint32_t>& indexes = chunk.shardRecords[shard];
+    
+    if (timeTrace) {
+        owner.timeTrace.str("");
+        owner.lineEnds.clear();
+    }
+    
+    for (size_t i = 0; i < indexes.size(); i++) {
+        
+        if (i + SHARD_PREFETCH_DISTANCE < indexes.size()) {
+            owner.cache->prefetch(chunk.records[indexes[i + SHARD_PREFETCH_DISTANCE]].addr);
+        }
+        
+        const TraceRecord& record = chunk.records[indexes[i]];
+        bool dirty = (record.type == TRACE_EVICT_DIRTY);
+        bool affectReadHitRatio = ((record.type == TRACE_READ) || (record.type == TRACE_WRITE) || (record.type == TRACE_FETCH));
+        auto ret = owner.cache->request(record.addr, dirty, affectReadHitRatio, record.value);
+        
+        if (countExact2WBs && !ret.first && ret.second.dirty) {
+            owner.countExact2WBs[ret.second.content.addr >> bitsBeforeIndex]++;
+        }
+        
+        if (timeTrace) {
+            long double time = chunk.timers[indexes[i]];
+            
+            if (!ret.first) {
+                //miss
+                owner.timeTrace << record.addr << " R " << time << " " << record.value << "\n";
+                
+                if (ret.second.dirty) { //dirty eviction
+                    owner.timeTrace << ret.second.content.addr << " W " << time << " " << ret.second.content.value << "\n";
+                }
+                
+            }
+            
+            owner.lineEnds.push_back((size_t) owner.timeTrace.tellp());
+        }
+        
+    }
+    
+}
+
+void ShardedLru::merge(const Chunk& chunk) {
+    vector<string> texts(shardCount);
+    vector<size_t> lines(shardCount, 0);
+    vector<size_t> begins(shardCount, 0);
+    
+    for (int i = 0; i < shardCount; i++) {
+        texts[i] = shards[i].timeTrace.str();
+    }
+    
+    for (size_t i = 0; i < chunk.count; i++) {
+        int shard = chunk.shardOf[i];
+        size_t end = shards[shard].lineEnds[lines[shard]++];
+        timeTraceOut->write(texts[shard].data() + begins[shard], end - begins[shard]);
+        begins[shard] = end;
+    }
+    
+}
+
+void ShardedLru::run(TraceReader* trace) {
+    int current = 0;
+    bool more = fill(trace, chunks[current]);
+    
+    while (chunks[current].count != 0) {
+        {
+            lock_guard<mutex> guard(lock);
+            pending = shardCount;
+            published++;
+        }
+        
+        wake.notify_all();
+        //overlaps the simulation of the current chunk; an exhausted trace is not read again, as that would reset its count of ignored lines
+        if (more) {
+            more = fill(trace, chunks[1 - current]);
+        } else {
+            chunks[1 - current].count = 0;
+        }
+        
+        
+        {
+            unique_lock<mutex> guard(lock);
+            done.wait(guard, [&] { return pending == 0; });
+        }
+        
+        if (timeTrace) {
+            merge(chunks[current]);
+        }
+        
+        current = 1 - current;
+    }
+    
+}
+
+lli ShardedLru::getHitCount() const {
+    lli sum = 0;
+    
+    for (int i = 0; i < shardCount; i++) {
+        sum += shards[i].cache->getHitCount();
+    }
+    
+    return sum;
+}
+
+lli ShardedLru::getMissCount() const {
+    lli sum = 0;
+    
+    for (int i = 0; i < shardCount; i++) {
+        sum += shards[i].cache->getMissCount();
+    }
+    
+    return sum;
+}
+
+lli ShardedLru::getWriteBackCount() const {
+    lli sum = 0;
+    
+    for (int i = 0; i < shardCount; i++) {
+        sum += shards[i].cache->getWriteBackCount();
+    }
+    
+    return sum;
+}
+
+lli ShardedLru::getReadHits() const {
+    lli sum = 0;
+    
+    for (int i = 0; i < shardCount; i++) {
+        sum += shards[i].cache->readHits;
+    }
+    
+    return sum;
+}
+
+lli ShardedLru::getTotalReadAccess() const {
+    lli sum = 0;
+    
+    for (int i = 0; i < shardCount; i++) {
+        sum += shards[i].cache->totalReadAccess;
+    }
+    
+    return sum;
+}
+
+size_t ShardedLru::getWriteBackLogSize() const {
+    size_t sum = 0;
+    
+    for (int i = 0; i < shardCount; i++) {
+        sum += shards[i].cache->writeBackLog.size();
+    }
+    
+    return sum;
+}
+
+map<lli, unsigned int> ShardedLru::getCountExact2WBs() const {
+    map<lli, unsigned int> all;
+    
+    for (int i = 0; i < shardCount; i++) {
+        all.insert(shards[i].countExact2WBs.begin(), shards[i].countExact2WBs.end());
+    }
+    
+    return all;
+}
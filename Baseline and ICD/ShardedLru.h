@@ -0,0 +1,126 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef ShardedLru_h
+#define ShardedLru_h
+
+#include "Cache.h"
+#include "TraceReader.h"
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#define SHARD_CHUNK_RECORDS 65536
+#define SHARD_PREFETCH_DISTANCE 16 //records of a shard whose sets are loaded ahead of the current one
+
+/**
+ * A Cache split by set over worker threads. Shard s owns the sets whose index has s in its top bits, as a Cache of
+ * setCount / shardCount sets, so that every set sees its accesses in trace order. The trace is read in chunks; the
+ * next chunk is read while the workers simulate the current one. The statistics, and the time trace, which is merged
+ * back into trace order chunk by chunk, are identical to those of a single Cache.
+ */
+class ShardedLru {
+private:
+    struct Chunk {
+        vector<TraceRecord> records;
+        vector<long double> timers; //time of every record in the time trace
+        vector<uint16_t> shardOf;
+        vector<vector<uint32_t>> shardRecords; //indexes of the records of every shard, in trace order
+        size_t count;
+    };
+    
+    struct Shard {
+        Cache* cache;
+        map<lli, unsigned int> countExact2WBs;
+        ostringstream timeTrace; //lines of the current chunk
+        vector<size_t> lineEnds; //end of the lines of every record of the shard in timeTrace
+    };
+    
+    int shardCount;
+    int shardShift; //the shard of a set is its index shifted right by this
+    lli setMask;
+    int bitsBeforeIndex;
+    bool timeTrace;
+    bool countExact2WBs;
+    long double timer;
+    long double clkStep;
+    ostream* timeTraceOut;
+    
+    vector<Shard> shards;
+    Chunk chunks[2];
+    vector<thread> workers;
+    mutex lock;
+    condition_variable wake;
+    condition_variable done;
+    uint64_t published; //chunks handed to the workers
+    int pending; //workers still simulating the last published chunk
+    bool finished;
+    
+    /**
+     * Read and route the next chunk
+     * @return False if the trace was exhausted while filling it
+     */
+    bool fill(TraceReader* trace, Chunk& chunk);
+    
+    /**
+     * Body of worker threads
+     */
+    void work(int shard);
+    
+    /**
+     * Simulate the records of a shard in a chunk
+     */
+    void simulate(Chunk& chunk, int shard);
+    
+    /**
+     * Write the time trace of a chunk in trace order
+     */
+    void merge(const Chunk& chunk);
+    
+public:
+    /**
+     * Constructor; starts the workers
+     * @param initShardCount Number of worker threads; a power of two no larger than setCount
+     * @param initTimeTraceOut The time trace, or nullptr for none
+     */
+    ShardedLru(int setCount, int associativity, int blockOffset, int indexSize, int initShardCount, ostream* initTimeTraceOut, long double initClkStep, bool initCountExact2WBs);
+    
+    /**
+     * Destructor; stops the workers
+     */
+    ~ShardedLru();
+    
+    /**
+     * Simulate the whole trace
+     */
+    void run(TraceReader* trace);
+    
+    lli getHitCount() const;
+    lli getMissCount() const;
+    lli getWriteBackCount() const;
+    lli getReadHits() const;
+    lli getTotalReadAccess() const;
+    
+    /**
+     * @return Number of distinct blocks written back; shards never share a block
+     */
+    size_t getWriteBackLogSize() const;
+    
+    /**
+     * @return Write-backs of every block; valid if constructed with initCountExact2WBs
+     */
+    map<lli, unsigned int> getCountExact2WBs() const;
+};
+
+#endif /* ShardedLru_h */
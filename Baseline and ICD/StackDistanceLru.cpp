@@ -0,0 +1,140 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "StackDistanceLru.h"
+#include "CacheSet.h"
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+StackDistanceLru::StackDistanceLru(int minSetCount, int levelCount, int initAssociativity, int initBlockOffset): associativity(initAssociativity), bitsBeforeIndex(initBlockOffset + 2) {
+    
+    if ( (associativity < 1) || (associativity > CACHE_SET_MAX_WAYS) ) {
+        cout << "Associativity Must Be Between 1 And " << CACHE_SET_MAX_WAYS << "\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    if ( (minSetCount < 1) || ((minSetCount & (minSetCount - 1)) != 0) || (levelCount < 1) ) {
+        cout << "Set Count Must Be A Power Of Two\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    levels.resize(levelCount);
+    
+    for (int i = 0; i < levelCount; i++) {
+        Level& level = levels[i];
+        level.setCount = minSetCount << i;
+        level.stackArr.assign((size_t) level.setCount * associativity, 0);
+        level.fillArr.assign(level.setCount, 0);
+        level.hitCount = 0;
+        level.missCount = 0;
+        level.writeBackCount = 0;
+        level.readHits = 0;
+        level.totalReadAccess = 0;
+    }
+    
+}
+
+void StackDistanceLru::request(lli queryAddr, bool queryDirty, bool affectReadHitRatio) {
+    lli block = queryAddr >> bitsBeforeIndex;
+    bool searching = true; //false once the block missed; it misses in all smaller caches too
+    
+    for (int i = (int) levels.size() - 1; i >= 0; i--) {
+        Level& level = levels[i];
+        lli setIndex = block & (level.setCount - 1);
+        lli* stack = &level.stackArr[setIndex * associativity];
+        int fill = level.fillArr[setIndex];
+        int distance = fill;
+        
+        if (searching) {
+            
+            for (distance = 0; distance < fill; distance++) {
+                
+                if ((stack[distance] >> 1) == block) {
+                    break;
+                }
+                
+            }
+            
+            searching = (distance < fill);
+        }
+        
+        if (affectReadHitRatio) {
+            level.totalReadAccess++;
+        }
+        
+        lli entry = (block << 1) | queryDirty;
+        
+        if (distance < fill) {
+            //hit; the block keeps its dirty bit
+            entry |= stack[distance];
+            level.hitCount++;
+            
+            if (affectReadHitRatio) {
+                level.readHits++;
+            }
+            
+        } else {
+            level.missCount++;
+            
+            if (fill < associativity) {
+                level.fillArr[setIndex]++; //there are some empty places; the stack grows
+                distance = fill;
+            } else {
+                distance = associativity - 1; //the bottom of the stack is evicted
+                
+                if (stack[distance] & 1) {
+                    level.writeBackLog.insert(stack[distance] >> 1);
+                    level.writeBackCount++;
+                }
+                
+            }
+            
+        }
+        
+        memmove(stack + 1, stack, distance * sizeof(lli));
+        stack[0] = entry;
+    }
+    
+}
+
+int StackDistanceLru::getLevelCount() const {
+    return (int) levels.size();
+}
+
+int StackDistanceLru::getSetCount(int level) const {
+    return levels[level].setCount;
+}
+
+lli StackDistanceLru::getHitCount(int level) const {
+    return levels[level].hitCount;
+}
+
+lli StackDistanceLru::getMissCount(int level) const {
+    return levels[level].missCount;
+}
+
+lli StackDistanceLru::getWriteBackCount(int level) const {
+    return levels[level].writeBackCount;
+}
+
+lli StackDistanceLru::getReadHits(int level) const {
+    return levels[level].readHits;
+}
+
+lli StackDistanceLru::getTotalReadAccess(int level) const {
+    return levels[level].totalReadAccess;
+}
+
+lli StackDistanceLru::getWriteBackLogSize(int level) const {
+    return levels[level].writeBackLog.size();
+}
@@ -0,0 +1,82 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef StackDistanceLru_h
+#define StackDistanceLru_h
+
+#include "Block.h"
+#include <vector>
+#include <set>
+
+using namespace std;
+
+/**
+ * LRU caches of one associativity and every power-of-two set count in a range, simulated in a single pass.
+ *
+ * Each level keeps the LRU stack of every set, and the position of a block in its stack is its stack distance.
+ * With a fixed associativity a block hits iff its distance is below the associativity, so the stacks are kept
+ * only that deep; anything deeper misses whatever its exact distance. The set of a level is split into two sets
+ * at the next level, so a block that misses at some level misses at all smaller ones, and its stacks are not
+ * searched there. The dirty bit is stored in the stack entry and moves with it; the block is written back when
+ * it falls off the bottom of a stack dirty. Every level behaves exactly as a Cache of its geometry.
+ */
+class StackDistanceLru {
+private:
+    struct Level {
+        int setCount;
+        vector<lli> stackArr; //stack of set s is [s * associativity, (s + 1) * associativity); entries are block << 1 | dirty
+        vector<uint8_t> fillArr; //number of valid entries of every stack
+        lli hitCount;
+        lli missCount;
+        lli writeBackCount;
+        lli readHits;
+        lli totalReadAccess;
+        set<lli> writeBackLog;
+    };
+    
+    vector<Level> levels; //ascending set count
+    int associativity;
+    int bitsBeforeIndex;
+    
+public:
+    /**
+     * Constructor
+     * @param minSetCount Set count of the smallest cache; a power of two
+     * @param levelCount Number of caches; each has twice the sets of the previous one
+     * @param initBlockOffset Number of rightmost bits that should be ignored, as for Cache
+     */
+    StackDistanceLru(int minSetCount, int levelCount, int initAssociativity, int initBlockOffset);
+    
+    /**
+     * Send a query to all the caches
+     */
+    void request(lli queryAddr, bool queryDirty, bool affectReadHitRatio);
+    
+    /**
+     * @return Number of caches
+     */
+    int getLevelCount() const;
+    
+    int getSetCount(int level) const;
+    lli getHitCount(int level) const;
+    lli getMissCount(int level) const;
+    lli getWriteBackCount(int level) const;
+    lli getReadHits(int level) const;
+    lli getTotalReadAccess(int level) const;
+    
+    /**
+     * @return Number of distinct blocks written back, as writeBackLog.size() of Cache
+     */
+    lli getWriteBackLogSize(int level) const;
+};
+
+#endif /* StackDistanceLru_h */
@@ -0,0 +1,43 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "PolicyRegistry.h"
+#include "BaselineRun.h"
+#include "WadeRun.h"
+#include "HapRun.h"
+#include "ZcacheRun.h"
+
+const Policy policies[] = {
+    {"lru", "LRU baseline", 4, false, true, true, false, true, true, true, true, false, BASELINE_VERSION, runLru},
+    {"lru-sweep", "LRU baseline at every power-of-two size in one pass", 4, false, false, false, true, false, false, false, false, false, BASELINE_VERSION, runLruSweep},
+    {"icd", "LRU with in-cache displacement into cuckoo ways", 4, true, true, true, false, false, true, true, true, false, BASELINE_VERSION, runIcd},
+    {"opt", "Belady MIN, the offline bound on misses (trace file only)", 4, false, false, false, false, false, false, false, false, true, BASELINE_VERSION, runOpt},
+    {"opt-wb", "offline heuristic favouring clean victims to cut write-backs (trace file only)", 4, false, false, false, false, false, false, false, false, true, BASELINE_VERSION, runOptWriteAware},
+    {"wade", "WADE", 8, false, false, true, false, false, true, false, true, false, WADE_VERSION, runWade},
+    {"hap", "HAP", 16, false, false, true, false, false, true, false, true, false, HAP_VERSION, runHap},
+    {"zcache", "bucketed LRU zcache", 4, false, false, false, false, false, true, false, false, false, ZCACHE_VERSION, runZcache}
+};
+
+const int policyCount = sizeof(policies) / sizeof(policies[0]);
+
+const Policy* findPolicy(const std::string& name) {
+    
+    for (int i = 0; i < policyCount; i++) {
+        
+        if (name == policies[i].name) {
+            return &policies[i];
+        }
+        
+    }
+    
+    return nullptr;
+}
@@ -0,0 +1,50 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef PolicyRegistry_h
+#define PolicyRegistry_h
+
+#include "RunConfig.h"
+#include <string>
+
+/**
+ * A cache model the driver can simulate
+ */
+struct Policy {
+    const char* name;
+    const char* description;
+    int defaultAssociativity;
+    bool cuckoo; //needs a cuckoo way count and a threshold
+    bool analyses; //supports the coalesce and exact 2 write-backs analyses
+    bool timeTrace; //can write a time trace
+    bool sweep; //simulates every size from the cache size to the maximum cache size
+    bool threads; //can share its sets among several threads
+    bool checkpoint; //can save its state to a snapshot and resume from one
+    bool sampling; //can simulate a sample of its sets and estimate the totals from it
+    bool timeSampling; //can measure windows of the trace and only warm up in between (see TimeSampler)
+    bool offline; //reads the trace file twice, so it cannot take its queries from a sweep or from stdin
+    const char* version; //of the model; cached results of other versions are not reused (see ResultCache)
+    int (*run)(const RunConfig& config); //selects the specialized code for the configuration once, then runs it
+};
+
+/**
+ * All the policies, in the order they are listed in the usage message
+ */
+extern const Policy policies[];
+extern const int policyCount;
+
+/**
+ * @return The policy called name, or nullptr if there is none
+ */
+const Policy* findPolicy(const std::string& name);
+
+#endif /* PolicyRegistry_h */
@@ -0,0 +1,294 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "ResultCache.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <vector>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define RESULT_CACHE_MAGIC "ICD RESULT 1" //first line of every entry; bump it when the key or the layout of an entry changes
+#define RESULT_CACHE_READ_BYTES (1 << 20) //the trace is hashed in blocks of that many bytes
+
+using namespace std;
+
+static inline uint64_t rotate(uint64_t word, int bits) {
+    return (word << bits) | (word >> (64 - bits));
+}
+
+/**
+ * Finalizer of MurmurHash3; every bit of the result depends on every bit of the hash
+ */
+static inline uint64_t avalanche(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/**
+ * 64-bit hash of a byte string; four independent lanes of 8 bytes each, so that the multiplications overlap
+ */
+class ContentHash {
+private:
+    uint64_t lanes[4];
+    uint64_t length;
+    
+public:
+    ContentHash(): length(0) {
+        
+        for (int i = 0; i < 4; i++) {
+            lanes[i] = 0x9e3779b97f4a7c15ULL * (i + 1);
+        }
+        
+    }
+    
+    void update(const uint8_t* data, size_t size) {
+        size_t i = 0;
+        
+        for (; i + 32 <= size; i += 32) {
+            
+            for (int lane = 0; lane < 4; lane++) {
+                uint64_t word;
+                memcpy(&word, data + i + 8 * lane, 8);
+                lanes[lane] = rotate(lanes[lane] ^ (word * 0x87c37b91114253d5ULL), 31) * 0x4cf5ad432745937fULL;
+            }
+            
+        }
+        
+        //the tail is padded with zeros; the length tells it from data that ends in zeros
+        if (i < size) {
+            uint8_t tail[32] = {};
+            memcpy(tail, data + i, size - i);
+            update(tail, 32);
+            length -= 32;
+        }
+        
+        length += size;
+    }
+    
+    uint64_t digest() const {
+        uint64_t hash = length;
+        
+        for (int i = 0; i < 4; i++) {
+            hash = avalanche(hash ^ lanes[i]);
+        }
+        
+        return hash;
+    }
+};
+
+static string toHex(uint64_t value) {
+    char text[17];
+    snprintf(text, sizeof(text), "%016llx", (unsigned long long) value);
+    return text;
+}
+
+static uint64_t hashString(const string& text) {
+    ContentHash hash;
+    hash.update((const uint8_t*) text.data(), text.size());
+    return hash.digest();
+}
+
+/**
+ * @return Hex content hash of the trace; taken from the store if the trace has not changed since it was last hashed
+ */
+static string fingerprint(const string& tracePath, const string& cacheDir) {
+    struct stat info;
+    
+    if (stat(tracePath.c_str(), &info) != 0) {
+        cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    //a trace is known by its identity on disk, its size and its modification time
+    ostringstream identity;
+    identity << info.st_dev << " " << info.st_ino << " " << info.st_size << " " << info.st_mtim.tv_sec << "." << info.st_mtim.tv_nsec;
+    string memoPath = cacheDir + "/trace-" + toHex(hashString(identity.str())) + ".txt";
+    ifstream memo(memoPath);
+    string memoIdentity, memoHash;
+    
+    if ( getline(memo, memoIdentity) && getline(memo, memoHash) && (memoIdentity == identity.str()) ) {
+        return memoHash;
+    }
+    
+    FILE* file = fopen(tracePath.c_str(), "rb");
+    
+    if (file == nullptr) {
+        cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    ContentHash hash;
+    vector<uint8_t> block(RESULT_CACHE_READ_BYTES);
+    size_t size;
+    
+    //every block but the last is whole, so the tail padding only ever applies at the end
+    while ((size = fread(block.data(), 1, block.size(), file)) != 0) {
+        hash.update(block.data(), size);
+    }
+    
+    fclose(file);
+    string result = toHex(hash.digest());
+    string tempPath = memoPath + "." + to_string(getpid()) + ".tmp";
+    ofstream memoOut(tempPath);
+    memoOut << identity.str() << "\n" << result << "\n";
+    memoOut.close();
+    
+    if ( memoOut.fail() || (rename(tempPath.c_str(), memoPath.c_str()) != 0) ) {
+        remove(tempPath.c_str()); //the hash is still right; it is only computed again next time
+    }
+    
+    return result;
+}
+
+/**
+ * @return Every setting that can change the report, in a fixed order and named as the options of the driver;
+ * the trace is not among them, and neither are the outputs besides the report, which the store does not apply to
+ */
+static string canonicalConfig(const RunConfig& config) {
+    ostringstream text;
+    text << "model=" << config.model;
+    text << " size=" << config.cacheKiB;
+    text << " max-size=" << config.maxCacheKiB;
+    text << " ways=" << config.associativity;
+    text << " block=" << config.blockBytes;
+    text << " cuckoo-ways=" << config.cuckooWayCount;
+    text << " threshold=" << config.threshold;
+    text << " search-depth=" << config.searchDepth;
+    text << " coalesce=" << config.coalesce;
+    text << " count-exact2wbs=" << config.countExact2WBs;
+    text << " threads=" << config.threads;
+    text << " sample-sets=" << config.sampleSets;
+    text << " sample-length=" << config.sampleLength;
+    text << " sample-period=" << config.samplePeriod;
+    text.precision(17);
+    text << " sample-error=" << config.sampleError;
+    return text.str();
+}
+
+/**
+ * Print the report of an entry
+ * @return False if there is no entry with that key
+ */
+static bool printEntry(const string& entryPath, const string& key) {
+    ifstream entry(entryPath, ios::binary);
+    
+    if (!entry.is_open()) {
+        return false;
+    }
+    
+    //an entry of another version of the model, or whose key merely hashed alike, is a miss and is replaced
+    string header(key.size(), '\0');
+    
+    if ( !entry.read(&header[0], header.size()) || (header != key) ) {
+        return false;
+    }
+    
+    cout << entry.rdbuf();
+    cout << "(REPORT READ FROM THE RESULT CACHE " << entryPath << ")" << endl;
+    return true;
+}
+
+/**
+ * Simulate the run in a process of its own and copy its output both to stdout and to the entry
+ * @return Exit status of the run
+ */
+static int runAndStore(const Policy& policy, const RunConfig& config, const string& entryPath, const string& key) {
+    int ends[2];
+    
+    if (pipe(ends) != 0) {
+        cout << "Pipe Cannot Be Created\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    cout.flush();
+    pid_t pid = fork();
+    
+    if (pid == 0) {
+        close(ends[0]);
+        dup2(ends[1], STDOUT_FILENO);
+        close(ends[1]);
+        int status = policy.run(config);
+        cout.flush();
+        exit(status);
+    } else if (pid < 0) {
+        cout << "Process Cannot Be Created\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    close(ends[1]);
+    string tempPath = entryPath + "." + to_string(getpid()) + ".tmp";
+    FILE* entry = fopen(tempPath.c_str(), "wb");
+    
+    if (entry == nullptr) {
+        cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    fwrite(key.data(), 1, key.size(), entry);
+    vector<char> block(RESULT_CACHE_READ_BYTES);
+    ssize_t size;
+    
+    while ( ((size = read(ends[0], block.data(), block.size())) > 0) || ((size < 0) && (errno == EINTR)) ) {
+        
+        if (size > 0) {
+            cout.write(block.data(), size);
+            cout.flush();
+            fwrite(block.data(), 1, size, entry);
+        }
+        
+    }
+    
+    close(ends[0]);
+    int status;
+    waitpid(pid, &status, 0);
+    status = WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
+    
+    //only the report of a run that succeeded is stored
+    if ( (fclose(entry) != 0) || (status != 0) || (rename(tempPath.c_str(), entryPath.c_str()) != 0) ) {
+        remove(tempPath.c_str());
+    }
+    
+    return status;
+}
+
+int runCached(const Policy& policy, const RunConfig& config, const string& cacheDir) {
+    
+    if ( (mkdir(cacheDir.c_str(), 0755) != 0) && (errno != EEXIST) ) {
+        cout << "Result Cache Cannot Be Created\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    ostringstream key;
+    key << RESULT_CACHE_MAGIC << "\n";
+    key << "version " << policy.version << "\n";
+    key << "config " << canonicalConfig(config) << "\n";
+    key << "trace " << fingerprint(config.tracePath, cacheDir) << "\n";
+    string entryPath = cacheDir + "/result-" + toHex(hashString(key.str())) + ".txt";
+    
+    if (printEntry(entryPath, key.str())) {
+        return 0;
+    }
+    
+    return runAndStore(policy, config, entryPath, key.str());
+}
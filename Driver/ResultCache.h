@@ -0,0 +1,30 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef ResultCache_h
+#define ResultCache_h
+
+#include "PolicyRegistry.h"
+#include <string>
+
+/**
+ * Run a configuration through an on-disk store of reports. An entry is keyed by the version of the model, a canonical
+ * string of the configuration and a content hash of the trace; on a hit its report is printed without simulating,
+ * and on a miss the run is simulated in a process of its own, whose report is printed as it comes and stored once
+ * the run succeeds. Entries are written next to their place and renamed into it, so concurrent runs never see a partial one
+ * @param cacheDir Directory of the store; the content hashes of the traces are kept there too, under the size and
+ * modification time of the trace, so that an unchanged trace is hashed once
+ * @return Exit status
+ */
+int runCached(const Policy& policy, const RunConfig& config, const std::string& cacheDir);
+
+#endif /* ResultCache_h */
@@ -0,0 +1,349 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "Sweep.h"
+#include "RecordStream.h"
+#include "TraceReader.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <csignal>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define SWEEP_BATCH_RECORDS 16384 //records parsed into each batch
+#define SWEEP_DEPTH 8 //batches the parser may be ahead of the slowest point
+#define SWEEP_PIPE_BYTES (1 << 20) //the pipes are enlarged to that, where the system allows it
+
+using namespace std;
+
+typedef shared_ptr<const vector<TraceRecord>> Batch;
+
+/**
+ * The batches of one round, parsed once and shared by the senders of every point; a batch is never written to once
+ * published, and is freed once every sender has taken it
+ */
+class Broadcast {
+private:
+    mutex lock;
+    condition_variable changed;
+    deque<Batch> batches; //the batches some sender has not taken yet; the first one is batch number first
+    uint64_t first;
+    uint64_t published;
+    bool finished;
+    uint64_t trailingIgnored;
+    vector<uint64_t> positions; //next batch of each sender; UINT64_MAX once its point needs no more of the trace
+    
+    uint64_t slowest() const {
+        uint64_t position = UINT64_MAX;
+        
+        for (size_t i = 0; i < positions.size(); i++) {
+            position = min(position, positions[i]);
+        }
+        
+        return position;
+    }
+    
+    void dropTaken() {
+        uint64_t position = slowest();
+        
+        while ( !batches.empty() && (first < position) ) {
+            batches.pop_front();
+            first++;
+        }
+        
+    }
+    
+public:
+    Broadcast(int senderCount): first(0), published(0), finished(false), trailingIgnored(0), positions(senderCount, 0) {
+        
+    }
+    
+    /**
+     * Append a batch, once the slowest sender is less than SWEEP_DEPTH batches behind
+     * @return False if no point needs the trace anymore
+     */
+    bool publish(const Batch& batch) {
+        unique_lock<mutex> guard(lock);
+        changed.wait(guard, [this] { return (slowest() == UINT64_MAX) || (published - slowest() < SWEEP_DEPTH); });
+        
+        if (slowest() == UINT64_MAX) {
+            return false;
+        }
+        
+        batches.push_back(batch);
+        published++;
+        changed.notify_all();
+        return true;
+    }
+    
+    void finish(uint64_t initTrailingIgnored) {
+        lock_guard<mutex> guard(lock);
+        trailingIgnored = initTrailingIgnored;
+        finished = true;
+        changed.notify_all();
+    }
+    
+    /**
+     * @return The next batch of a sender, or nullptr at the end of the trace
+     */
+    Batch take(int sender) {
+        unique_lock<mutex> guard(lock);
+        changed.wait(guard, [this, sender] { return finished || (positions[sender] < published); });
+        
+        if (positions[sender] == published) {
+            return nullptr;
+        }
+        
+        Batch batch = batches[positions[sender] - first];
+        positions[sender]++;
+        dropTaken();
+        changed.notify_all();
+        return batch;
+    }
+    
+    /**
+     * Let the others go on without a sender whose point has stopped reading
+     */
+    void leave(int sender) {
+        lock_guard<mutex> guard(lock);
+        positions[sender] = UINT64_MAX;
+        dropTaken();
+        changed.notify_all();
+    }
+    
+    uint64_t getTrailingIgnored() {
+        lock_guard<mutex> guard(lock);
+        return trailingIgnored;
+    }
+};
+
+/**
+ * Body of a sender thread: write every batch to the stdin of a point
+ */
+static void send(Broadcast& broadcast, int sender, int fd, uint64_t leadingIgnored) {
+    RecordStreamWriter stream(fd, leadingIgnored);
+    Batch batch;
+    
+    while ((batch = broadcast.take(sender)) != nullptr) {
+        
+        if (!stream.write(batch->data(), (uint32_t) batch->size())) {
+            broadcast.leave(sender); //the point quit, as time sampling does once it is precise enough
+            break;
+        }
+        
+    }
+    
+    stream.close(broadcast.getTrailingIgnored());
+}
+
+/**
+ * Body of the process of a point; never returns
+ * @param fds The pipes of the round; all but the one the point reads are closed
+ */
+static void runPoint(const SweepPoint& point, int readEnd, const vector<int>& fds, const string& reportPath) {
+    
+    for (size_t i = 0; i < fds.size(); i++) {
+        
+        if (fds[i] != readEnd) {
+            close(fds[i]);
+        }
+        
+    }
+    
+    int report = open(reportPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    
+    if (report < 0) {
+        cout << "Specified File Cannot Be Opened\n";
+        _exit(EXIT_FAILURE);
+    }
+    
+    dup2(readEnd, STDIN_FILENO);
+    dup2(report, STDOUT_FILENO);
+    dup2(report, STDERR_FILENO);
+    close(readEnd);
+    close(report);
+    
+    RunConfig config = point.config;
+    config.traceOnStdin = true; //tracePath is kept for the report
+    int status = point.policy->run(config);
+    cout.flush();
+    exit(status);
+}
+
+/**
+ * @return The first word after the first label found at the start of a line of a report, or "" if there is none
+ */
+static string findValue(const string& reportPath, const char* label, const char* altLabel) {
+    ifstream report(reportPath);
+    string line;
+    
+    while (getline(report, line)) {
+        string rest;
+        
+        if (line.compare(0, strlen(label), label) == 0) {
+            rest = line.substr(strlen(label));
+        } else if (line.compare(0, strlen(altLabel), altLabel) == 0) {
+            rest = line.substr(strlen(altLabel));
+        } else {
+            continue;
+        }
+        
+        istringstream words(rest);
+        string value;
+        words >> value;
+        return value;
+    }
+    
+    return "";
+}
+
+static string reportPathOf(const string& outPrefix, size_t point) {
+    return outPrefix + "-" + to_string(point) + ".txt";
+}
+
+int runSweep(const vector<SweepPoint>& points, const string& tracePath, int jobs, const string& outPrefix) {
+    size_t roundSize = (jobs > 0) ? (size_t) jobs : points.size();
+    
+    if ( (roundSize < points.size()) && (tracePath.empty() || (tracePath == "-")) ) {
+        cout << "A Sweep Of Stdin Must Run All Its Points At Once\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    signal(SIGPIPE, SIG_IGN); //a point that quits early shows up as a failed write
+    vector<int> statuses(points.size(), EXIT_FAILURE);
+    cout << "SWEEP: \t\t" << points.size() << " POINTS, " << (points.size() + roundSize - 1) / roundSize << " ROUNDS" << endl;
+    
+    for (size_t begin = 0; begin < points.size(); begin += roundSize) {
+        size_t end = min(points.size(), begin + roundSize);
+        vector<int> fds;
+        
+        for (size_t i = begin; i < end; i++) {
+            int ends[2];
+            
+            if (pipe(ends) != 0) {
+                cout << "Pipe Cannot Be Created\n";
+                exit(EXIT_FAILURE);
+            }
+            
+#ifdef F_SETPIPE_SZ
+            fcntl(ends[1], F_SETPIPE_SZ, SWEEP_PIPE_BYTES);
+#endif
+            fds.push_back(ends[0]);
+            fds.push_back(ends[1]);
+        }
+        
+        //the points are forked before any thread is started
+        vector<pid_t> pids;
+        cout.flush();
+        
+        for (size_t i = begin; i < end; i++) {
+            cout << "POINT " << i << ": \t" << points[i].settings << " -> " << reportPathOf(outPrefix, i) << endl;
+            pid_t pid = fork();
+            
+            if (pid == 0) {
+                runPoint(points[i], fds[2 * (i - begin)], fds, reportPathOf(outPrefix, i));
+            } else if (pid < 0) {
+                cout << "Process Cannot Be Created\n";
+                exit(EXIT_FAILURE);
+            }
+            
+            pids.push_back(pid);
+        }
+        
+        for (size_t i = 0; i < pids.size(); i++) {
+            close(fds[2 * i]);
+        }
+        
+        TraceReader* trace = openTrace(tracePath);
+        Broadcast broadcast((int) pids.size());
+        vector<thread> senders;
+        
+        for (size_t i = 0; i < pids.size(); i++) {
+            senders.push_back(thread(send, ref(broadcast), (int) i, fds[2 * i + 1], trace->getLeadingIgnored()));
+        }
+        
+        bool more = true;
+        
+        while (more) {
+            shared_ptr<vector<TraceRecord>> batch = make_shared<vector<TraceRecord>>(SWEEP_BATCH_RECORDS);
+            size_t count = 0;
+            
+            while ( (count < SWEEP_BATCH_RECORDS) && (more = trace->next((*batch)[count])) ) {
+                count++;
+            }
+            
+            batch->resize(count);
+            
+            if ( (count != 0) && !broadcast.publish(batch) ) {
+                break; //every point has stopped reading
+            }
+            
+        }
+        
+        broadcast.finish(trace->getTrailingIgnored());
+        
+        for (size_t i = 0; i < senders.size(); i++) {
+            senders[i].join();
+        }
+        
+        delete trace;
+        
+        for (size_t i = 0; i < pids.size(); i++) {
+            int status;
+            waitpid(pids[i], &status, 0);
+            statuses[begin + i] = WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
+        }
+        
+    }
+    
+    //one line per point; the figures are those of the report, so a point that failed leaves them empty
+    ofstream csv(outPrefix + ".csv");
+    
+    if (!csv.is_open()) {
+        cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    csv << "point,model,settings,status,queries,write_backs,read_hit_ratio,report\n";
+    cout << "POINT\tSTATUS\tTOTAL QUERIES\tWRITE BACK COUNT\tREAD HIT RATIO\tSETTINGS\n";
+    int failed = 0;
+    
+    for (size_t i = 0; i < points.size(); i++) {
+        string reportPath = reportPathOf(outPrefix, i);
+        string queries = findValue(reportPath, "TOTAL QUERIES:", "total accesses :");
+        string writeBacks = findValue(reportPath, "WRITE BACK COUNT:", "number of writebacks :");
+        string readHitRatio = findValue(reportPath, "READ HIT RATIO:", "read_hit_ratio :");
+        string settings = points[i].settings;
+        
+        for (size_t quote = settings.find('"'); quote != string::npos; quote = settings.find('"', quote + 2)) {
+            settings.insert(quote, "\"");
+        }
+        
+        csv << i << "," << points[i].config.model << ",\"" << settings << "\"," << statuses[i] << "," << queries << "," << writeBacks << "," << readHitRatio << "," << reportPath << "\n";
+        cout << i << "\t" << statuses[i] << "\t" << queries << "\t" << writeBacks << "\t" << readHitRatio << "\t" << points[i].settings << "\n";
+        failed += (statuses[i] != 0);
+    }
+    
+    cout << "(" << failed << " POINTS FAILED; SUMMARY WRITTEN TO " << outPrefix << ".csv)" << endl;
+    return (failed == 0) ? 0 : EXIT_FAILURE;
+}
@@ -0,0 +1,39 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef Sweep_h
+#define Sweep_h
+
+#include "PolicyRegistry.h"
+#include <string>
+#include <vector>
+
+/**
+ * One configuration of a sweep
+ */
+struct SweepPoint {
+    RunConfig config;
+    const Policy* policy;
+    std::string settings; //its line of the sweep file, as given
+};
+
+/**
+ * Simulate every point on the same trace. Each point runs in a process of its own, as the models keep their state
+ * and print their reports through process-wide variables; the trace is parsed once into shared batches of records,
+ * which sender threads broadcast to the points as record streams (see RecordStream) on their stdin
+ * @param jobs Points simulated at once; the trace is parsed once per round of that many points, and 0 runs them all in one round
+ * @param outPrefix The report of point i is written to outPrefix-i.txt, and one line per point to outPrefix.csv
+ * @return Exit status; failure if a point failed
+ */
+int runSweep(const std::vector<SweepPoint>& points, const std::string& tracePath, int jobs, const std::string& outPrefix);
+
+#endif /* Sweep_h */
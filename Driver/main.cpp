@@ -0,0 +1,473 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
+#include <sstream>
+#include <vector>
+#include "PolicyRegistry.h"
+#include "Sweep.h"
+#include "ResultCache.h"
+
+using namespace std;
+
+//settings of the driver itself rather than of a simulation
+static string sweepPath; //empty simulates the one configuration of the command line
+static int sweepJobs = 0;
+static string sweepOut = "sweep";
+static string resultCacheDir; //empty always simulates
+
+/*
+ * usage: Driver [options] [trace]
+ * options are also read from config files, one "key = value" per line ("key" alone for flags, "#" starts a comment);
+ * the keys are the long options without the dashes, plus "trace", and later settings override earlier ones;
+ * a sweep file holds one point per line, as settings separated by blanks ("key=value", or "key" for flags), which
+ * apply on top of the options
+ */
+static void usage() {
+    cout << "Usage: Driver [options] [trace]\n";
+    cout << "  --model NAME         policy to simulate:";
+    
+    for (int i = 0; i < policyCount; i++) {
+        cout << " " << policies[i].name;
+    }
+    
+    cout << "\n";
+    cout << "  --size KIB           cache size (default 512)\n";
+    cout << "  --max-size KIB       largest cache size (lru-sweep)\n";
+    cout << "  --ways N             associativity (default depends on the model)\n";
+    cout << "  --block BYTES        block size (default 64)\n";
+    cout << "  --cuckoo-ways N      ways displaced into the cuckoo region (icd)\n";
+    cout << "  --threshold N        displacement threshold (icd)\n";
+    cout << "  --search-depth N     insert by a breadth-first search of N displacements at most (icd; default 0, the walk)\n";
+    cout << "  --coalesce           coalesce analysis (lru, icd)\n";
+    cout << "  --count-exact2wbs    count blocks written back exactly twice (lru, icd)\n";
+    cout << "  --time-trace FILE    write the time trace (energy trace for hap)\n";
+    cout << "  --clk-step X         time between two reads or writes in the time trace\n";
+    cout << "  --threads N          share the sets among N threads, a power of two (lru; default 1)\n";
+    cout << "  --sample-sets N      simulate 1 in N sets and estimate the totals, a power of two (lru, icd; default 1)\n";
+    cout << "  --sample-length N    time sampling: measure N queries out of every sample period (lru, icd, wade, hap)\n";
+    cout << "  --sample-period N    queries from one measured window to the next; the others only warm the cache up\n";
+    cout << "  --sample-error X     stop once the 95% margins are below X times the estimates (default 0, never)\n";
+    cout << "  --telemetry FILE     write the load of the cuckoo ways and the tail of its displacements to FILE as CSV (icd)\n";
+    cout << "  --telemetry-every N  queries from one row of the telemetry to the next\n";
+    cout << "  --checkpoint FILE    save the simulation state to FILE at the end of the trace\n";
+    cout << "  --checkpoint-every N also save it after every N queries\n";
+    cout << "  --restore FILE       resume from a state saved with the same configuration and trace\n";
+    cout << "  --config FILE        read options from FILE\n";
+    cout << "  --sweep FILE         simulate every point of FILE on the trace, which is parsed once for all of them\n";
+    cout << "  --jobs N             points of a sweep simulated at once (default 0, all)\n";
+    cout << "  --sweep-out PREFIX   reports of a sweep go to PREFIX-N.txt and its summary to PREFIX.csv (default sweep)\n";
+    cout << "  --result-cache DIR   print the stored report of a run done before on the same trace, or store the new one\n";
+    cout << "the trace is read from stdin if not given\n";
+}
+
+static void badArgument(const string& what) {
+    cout << "Runtime Argument Bad Format: " << what << "\n";
+    usage();
+    exit(EXIT_FAILURE);
+}
+
+static long long toLongLong(const string& key, const string& value) {
+    char* end;
+    errno = 0;
+    long long result = strtoll(value.c_str(), &end, 10);
+    
+    if ( value.empty() || (*end != '\0') || (errno == ERANGE) ) {
+        badArgument(key + " " + value);
+    }
+    
+    return result;
+}
+
+static int toInt(const string& key, const string& value) {
+    long long result = toLongLong(key, value);
+    
+    if ( (result < INT_MIN) || (result > INT_MAX) ) {
+        badArgument(key + " " + value);
+    }
+    
+    return (int) result;
+}
+
+static bool toBool(const string& key, const string& value) {
+    
+    if ( value.empty() || (value == "1") || (value == "true") || (value == "yes") ) {
+        return true;
+    } else if ( (value == "0") || (value == "false") || (value == "no") ) {
+        return false;
+    }
+    
+    badArgument(key + " " + value);
+    return false;
+}
+
+static void readConfigFile(const string& path, RunConfig& config);
+
+/**
+ * @return True if the key is a flag, which takes no value on the command line
+ */
+static bool isFlag(const string& key) {
+    return (key == "coalesce") || (key == "count-exact2wbs");
+}
+
+/**
+ * Apply one setting to the configuration
+ */
+static void apply(const string& key, const string& value, RunConfig& config) {
+    
+    if (key == "model") {
+        config.model = value;
+    } else if (key == "trace") {
+        config.tracePath = value;
+    } else if (key == "size") {
+        config.cacheKiB = toInt(key, value);
+    } else if (key == "max-size") {
+        config.maxCacheKiB = toInt(key, value);
+    } else if (key == "ways") {
+        config.associativity = toInt(key, value);
+    } else if (key == "block") {
+        config.blockBytes = toInt(key, value);
+    } else if (key == "cuckoo-ways") {
+        config.cuckooWayCount = toInt(key, value);
+    } else if (key == "threshold") {
+        config.threshold = toInt(key, value);
+    } else if (key == "search-depth") {
+        config.searchDepth = toInt(key, value);
+    } else if (key == "coalesce") {
+        config.coalesce = toBool(key, value);
+    } else if (key == "count-exact2wbs") {
+        config.countExact2WBs = toBool(key, value);
+    } else if (key == "time-trace") {
+        config.timeTracePath = value;
+    } else if (key == "clk-step") {
+        config.clkStep = atof(value.c_str());
+    } else if (key == "threads") {
+        config.threads = toInt(key, value);
+    } else if (key == "sample-sets") {
+        config.sampleSets = toInt(key, value);
+    } else if (key == "sample-length") {
+        config.sampleLength = toLongLong(key, value);
+    } else if (key == "sample-period") {
+        config.samplePeriod = toLongLong(key, value);
+    } else if (key == "sample-error") {
+        config.sampleError = atof(value.c_str());
+    } else if (key == "telemetry") {
+        config.telemetryPath = value;
+    } else if (key == "telemetry-every") {
+        config.telemetryEvery = toLongLong(key, value);
+    } else if (key == "checkpoint") {
+        config.checkpointPath = value;
+    } else if (key == "checkpoint-every") {
+        config.checkpointEvery = toLongLong(key, value);
+    } else if (key == "restore") {
+        config.restorePath = value;
+    } else if (key == "config") {
+        readConfigFile(value, config);
+    } else if (key == "sweep") {
+        sweepPath = value;
+    } else if (key == "jobs") {
+        sweepJobs = toInt(key, value);
+    } else if (key == "sweep-out") {
+        sweepOut = value;
+    } else if (key == "result-cache") {
+        resultCacheDir = value;
+    } else {
+        badArgument("unknown option " + key);
+    }
+    
+}
+
+static string trim(const string& text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    
+    if (begin == string::npos) {
+        return "";
+    }
+    
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+static void readConfigFile(const string& path, RunConfig& config) {
+    ifstream file(path);
+    
+    if (!file.is_open()) {
+        cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    string line;
+    
+    while (getline(file, line)) {
+        line = trim(line.substr(0, line.find('#')));
+        
+        if (line.empty()) {
+            continue;
+        }
+        
+        size_t equal = line.find('=');
+        
+        if (equal == string::npos) {
+            apply(line, "", config);
+        } else {
+            apply(trim(line.substr(0, equal)), trim(line.substr(equal + 1)), config);
+        }
+        
+    }
+    
+}
+
+/**
+ * Check the configuration against the policy and fill in its defaults
+ */
+static void validate(const Policy& policy, RunConfig& config) {
+    
+    if (config.associativity == 0) {
+        config.associativity = policy.defaultAssociativity;
+    }
+    
+    if ( (config.cacheKiB <= 0) || (config.associativity <= 0) || (config.blockBytes < 4) || ((config.blockBytes & (config.blockBytes - 1)) != 0) ) {
+        badArgument("bad cache geometry");
+    }
+    
+    if ( policy.cuckoo && ((config.cuckooWayCount <= 0) || (config.cuckooWayCount >= config.associativity)) ) {
+        badArgument("--cuckoo-ways must be between 1 and the associativity minus one");
+    }
+    
+    if ( !policy.cuckoo && ((config.cuckooWayCount != 0) || (config.threshold != 0)) ) {
+        badArgument(string("--cuckoo-ways and --threshold do not apply to ") + policy.name);
+    }
+    
+    if (config.searchDepth < 0) {
+        badArgument("--search-depth must not be negative");
+    } else if ( !policy.cuckoo && (config.searchDepth != 0) ) {
+        badArgument(string("--search-depth does not apply to ") + policy.name);
+    }
+    
+    if ( !policy.analyses && (config.coalesce || config.countExact2WBs) ) {
+        badArgument(string("--coalesce and --count-exact2wbs do not apply to ") + policy.name);
+    }
+    
+    if ( policy.offline && (config.tracePath.empty() || (config.tracePath == "-")) ) {
+        badArgument(string(policy.name) + " needs a trace file");
+    }
+    
+    if ( !policy.timeTrace && !config.timeTracePath.empty() ) {
+        badArgument(string("--time-trace does not apply to ") + policy.name);
+    }
+    
+    if (config.maxCacheKiB == 0) {
+        config.maxCacheKiB = config.cacheKiB;
+    } else if (!policy.sweep) {
+        badArgument(string("--max-size does not apply to ") + policy.name);
+    } else if (config.maxCacheKiB < config.cacheKiB) {
+        badArgument("--max-size must not be below --size");
+    }
+    
+    if ( (config.threads < 1) || ((config.threads & (config.threads - 1)) != 0) ) {
+        badArgument("--threads must be a power of two");
+    } else if ( !policy.threads && (config.threads != 1) ) {
+        badArgument(string("--threads does not apply to ") + policy.name);
+    } else if ( (config.threads != 1) && config.coalesce ) {
+        badArgument("--threads and --coalesce cannot be used together");
+    }
+    
+    if ( (config.sampleSets < 1) || ((config.sampleSets & (config.sampleSets - 1)) != 0) ) {
+        badArgument("--sample-sets must be a power of two");
+    } else if ( !policy.sampling && (config.sampleSets != 1) ) {
+        badArgument(string("--sample-sets does not apply to ") + policy.name);
+    } else if ( (config.sampleSets != 1) && (config.coalesce || config.countExact2WBs || !config.timeTracePath.empty() || (config.threads != 1)) ) {
+        badArgument("--sample-sets cannot be used with the analyses, --time-trace or --threads");
+    }
+    
+    if ( (config.sampleLength < 0) || (config.samplePeriod < 0) || (config.sampleError < 0) ) {
+        badArgument("--sample-length, --sample-period and --sample-error must not be negative");
+    } else if ( (config.sampleLength == 0) && ((config.samplePeriod != 0) || (config.sampleError != 0)) ) {
+        badArgument("--sample-period and --sample-error need --sample-length");
+    } else if ( (config.sampleLength != 0) && !policy.timeSampling ) {
+        badArgument(string("--sample-length does not apply to ") + policy.name);
+    } else if ( (config.sampleLength != 0) && (config.samplePeriod < config.sampleLength) ) {
+        badArgument("--sample-period must not be below --sample-length");
+    } else if ( (config.sampleLength != 0) && (config.coalesce || config.countExact2WBs || !config.timeTracePath.empty() || (config.threads != 1) || (config.sampleSets != 1)) ) {
+        badArgument("--sample-length cannot be used with the analyses, --time-trace, --threads or --sample-sets");
+    }
+    
+    if ( !policy.cuckoo && !config.telemetryPath.empty() ) {
+        badArgument(string("--telemetry does not apply to ") + policy.name);
+    } else if ( !config.telemetryPath.empty() && (config.telemetryEvery <= 0) ) {
+        badArgument("--telemetry needs a positive --telemetry-every");
+    } else if ( config.telemetryPath.empty() && (config.telemetryEvery != 0) ) {
+        badArgument("--telemetry-every needs --telemetry");
+    }
+    
+    bool snapshots = (!config.checkpointPath.empty() || !config.restorePath.empty());
+    
+    if ( !policy.checkpoint && snapshots ) {
+        badArgument(string("--checkpoint and --restore do not apply to ") + policy.name);
+    } else if ( (config.threads != 1) && snapshots ) {
+        badArgument("--threads and --checkpoint or --restore cannot be used together");
+    } else if ( (config.sampleSets != 1) && snapshots ) {
+        badArgument("--sample-sets and --checkpoint or --restore cannot be used together");
+    } else if ( (config.sampleLength != 0) && snapshots ) {
+        badArgument("--sample-length and --checkpoint or --restore cannot be used together");
+    } else if (config.checkpointEvery < 0) {
+        badArgument("--checkpoint-every must not be negative");
+    } else if ( (config.checkpointEvery != 0) && config.checkpointPath.empty() ) {
+        badArgument("--checkpoint-every needs --checkpoint");
+    }
+    
+}
+
+/**
+ * Read the points of a sweep; each one is the configuration of the command line with its own settings on top, validated
+ */
+static vector<SweepPoint> readSweepFile(const string& path, const RunConfig& common) {
+    ifstream file(path);
+    
+    if (!file.is_open()) {
+        cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+    
+    vector<SweepPoint> points;
+    string line;
+    
+    while (getline(file, line)) {
+        line = trim(line.substr(0, line.find('#')));
+        
+        if (line.empty()) {
+            continue;
+        }
+        
+        SweepPoint point;
+        point.config = common;
+        point.settings = line;
+        istringstream settings(line);
+        string setting;
+        
+        while (settings >> setting) {
+            size_t equal = setting.find('=');
+            string key = setting.substr(0, equal);
+            
+            if ( (key == "trace") || (key == "sweep") || (key == "jobs") || (key == "sweep-out") || (key == "result-cache") ) {
+                badArgument(key + " cannot differ between the points of a sweep");
+            }
+            
+            apply(key, (equal == string::npos) ? "" : setting.substr(equal + 1), point.config);
+        }
+        
+        point.policy = findPolicy(point.config.model);
+        
+        if (point.policy == nullptr) {
+            badArgument("unknown model \"" + point.config.model + "\" in sweep point " + line);
+        }
+        
+        //the points are fed from one pass over the trace
+        if (point.policy->offline) {
+            badArgument(string(point.policy->name) + " cannot be a sweep point, as it reads the trace file twice");
+        }
+        
+        //the summary has one row per point, and such a model reports a row per size
+        if (point.policy->sweep) {
+            badArgument(string(point.policy->name) + " cannot be a sweep point, as it reports several sizes; sweep the sizes instead");
+        }
+        
+        validate(*point.policy, point.config);
+        points.push_back(point);
+    }
+    
+    if (points.empty()) {
+        badArgument("the sweep has no points");
+    }
+    
+    return points;
+}
+
+int main(int argc, const char* argv[]) {
+    RunConfig config;
+    
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        
+        if ( (arg == "-h") || (arg == "--help") ) {
+            usage();
+            return 0;
+        } else if ( (arg.compare(0, 2, "--") != 0) || (arg == "--") ) {
+            
+            if (arg == "--") {
+                i++;
+            }
+            
+            if (i != argc - 1) {
+                badArgument("the trace must be the last argument");
+            }
+            
+            config.tracePath = argv[i];
+            continue;
+        }
+        
+        string key = arg.substr(2);
+        size_t equal = key.find('=');
+        
+        if (equal != string::npos) {
+            apply(key.substr(0, equal), key.substr(equal + 1), config);
+        } else if (isFlag(key)) {
+            apply(key, "", config);
+        } else if (i + 1 < argc) {
+            apply(key, argv[++i], config);
+        } else {
+            badArgument("missing value of --" + key);
+        }
+        
+    }
+    
+    if (!sweepPath.empty()) {
+        
+        if (sweepJobs < 0) {
+            badArgument("--jobs must not be negative");
+        } else if (!resultCacheDir.empty()) {
+            badArgument("--result-cache does not apply to a sweep");
+        }
+        
+        return runSweep(readSweepFile(sweepPath, config), config.tracePath, sweepJobs, sweepOut);
+    }
+    
+    if (config.model.empty()) {
+        badArgument("--model must be given");
+    }
+    
+    const Policy* policy = findPolicy(config.model);
+    
+    if (policy == nullptr) {
+        badArgument("unknown model " + config.model);
+    }
+    
+    validate(*policy, config);
+    
+    if (resultCacheDir.empty()) {
+        return policy->run(config);
+    }
+    
+    //a stored report stands for the whole run, so the run must have no other output, and a trace that can be hashed
+    if ( config.tracePath.empty() || (config.tracePath == "-") ) {
+        badArgument("--result-cache needs a trace file");
+    } else if ( !config.timeTracePath.empty() || !config.telemetryPath.empty() || !config.checkpointPath.empty() || !config.restorePath.empty() ) {
+        badArgument("--result-cache cannot be used with --time-trace, --telemetry, --checkpoint or --restore");
+    }
+    
+    return runCached(*policy, config, resultCacheDir);
+}
@@ -11,6 +11,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include "CSet.h"
 #include <cassert>
 
+namespace hap {
+
 CSet::CSet(int associativity): associativity(associativity), lNVM(0), isSample(false), type(-1), accessCounter(0), costCounter(0) {
     
 }
@@ -138,4 +140,39 @@ QRet CSet::query(CBlock newBlock) {
     }
     
     return ret;
-}
\ No newline at end of file
+}
+
+void CSet::save(SnapshotWriter& snapshot) const {
+    snapshot.put32(content.size());
+    
+    for (int i = 0; i < content.size(); i++) {
+        snapshot.put64(content.at(i).tag);
+        snapshot.put8(content.at(i).isNVM | (content.at(i).isDirty << 1) | (content.at(i).isChance << 2));
+        snapshot.putValue(content.at(i).value);
+    }
+    
+    snapshot.put32(lNVM);
+    snapshot.put32(accessCounter);
+    snapshot.put32(costCounter);
+}
+
+void CSet::load(SnapshotReader& snapshot) {
+    int blockCount = snapshot.get32();
+    
+    for (int i = 0; i < blockCount; i++) {
+        CBlock block;
+        block.tag = snapshot.get64();
+        uint8_t flags = snapshot.get8();
+        block.isNVM = flags & 1;
+        block.isDirty = (flags >> 1) & 1;
+        block.isChance = (flags >> 2) & 1;
+        snapshot.getValue(block.value);
+        content.push_back(block);
+    }
+    
+    lNVM = snapshot.get32();
+    accessCounter = snapshot.get32();
+    costCounter = snapshot.get32();
+}
+
+} // namespace hap
@@ -15,6 +15,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 using namespace std;
 
+namespace hap {
+
 class CSet { //cache set
 public:
 
@@ -38,7 +40,15 @@ public:
      * dirty eviction?
      */
     QRet query(CBlock newBlock);
+    
+    /*
+     * writes the blocks and the counters of the set to a snapshot, and reads them back into an empty set
+     */
+    void save(SnapshotWriter& snapshot) const;
+    void load(SnapshotReader& snapshot);
 
 };
 
+} // namespace hap
+
 #endif /* CSet_h */
\ No newline at end of file
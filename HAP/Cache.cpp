@@ -14,8 +14,10 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include <cmath>
 #include <cassert>
 
-Cache::Cache(int size, int associativity) {
-    setCount = (size * 1024) / associativity / 64;
+namespace hap {
+
+Cache::Cache(int size, int associativity, int blockSize) {
+    setCount = (size * 1024) / associativity / blockSize;
     
     for (int i = 0; i < SAMPLE_SET_TYPES; i++) {
         staticThresholds[i].lo = 0;
@@ -42,11 +44,12 @@ Cache::Cache(int size, int associativity) {
     readCount = 0;
     writebackCount = 0;
     queryCounter = 0;
-    bitLen.block = log2(BLOCK_SIZE);
+    histo = 0;
+    bitLen.block = log2(blockSize);
     bitLen.sets = log2(sets.size());
 }
 
-QRet Cache::query(llu addr, bool l1EvictDirty, bool isNVM, bool affectReadHitRatio, string value) {
+QRet Cache::query(llu addr, bool l1EvictDirty, bool isNVM, bool affectReadHitRatio, const BlockValue& value) {
     queryCounter++;
     
     if ((queryCounter % SAMPLE_POINT) == 0) {
@@ -86,8 +89,6 @@ QRet Cache::query(llu addr, bool l1EvictDirty, bool isNVM, bool affectReadHitRat
         writebackCount++;
     }
     
-    static llu histo = 0;
-    
     if (queryCounter - histo >= LOG_EVERY_QUERY_COUNT) {
         cout << setfill(' ') << "QUERY NO " << setw(10) << queryCounter << " FINISHED! ";
         cout.flush();
@@ -139,4 +140,49 @@ void Cache::samplePoint() {
     //set threshold to the minimum cost
     threshold.hi = staticThresholds[minIndx].hi;
     threshold.lo = ( (minIndx = 0) ? (0) : (staticThresholds[minIndx - 1].hi) );
-}
\ No newline at end of file
+}
+
+void Cache::save(SnapshotWriter& snapshot) const {
+    snapshot.put64(hitCount);
+    snapshot.put64(missCount);
+    snapshot.put64(readCount);
+    snapshot.put64(readHitCount);
+    snapshot.put64(writebackCount);
+    snapshot.put64(queryCounter);
+    snapshot.put32(threshold.hi);
+    snapshot.put32(threshold.lo);
+    
+    for (int i = 0; i < SAMPLE_SET_TYPES; i++) {
+        snapshot.put32(staticThresholds[i].hi);
+        snapshot.put32(staticThresholds[i].lo);
+    }
+    
+    for (int i = 0; i < setCount; i++) {
+        sets.at(i)->save(snapshot);
+    }
+    
+}
+
+void Cache::load(SnapshotReader& snapshot) {
+    hitCount = snapshot.get64();
+    missCount = snapshot.get64();
+    readCount = snapshot.get64();
+    readHitCount = snapshot.get64();
+    writebackCount = snapshot.get64();
+    queryCounter = snapshot.get64();
+    histo = queryCounter - (queryCounter % LOG_EVERY_QUERY_COUNT); //the progress reports go on where they stopped
+    threshold.hi = snapshot.get32();
+    threshold.lo = snapshot.get32();
+    
+    for (int i = 0; i < SAMPLE_SET_TYPES; i++) {
+        staticThresholds[i].hi = snapshot.get32();
+        staticThresholds[i].lo = snapshot.get32();
+    }
+    
+    for (int i = 0; i < setCount; i++) {
+        sets.at(i)->load(snapshot);
+    }
+    
+}
+
+} // namespace hap
@@ -16,6 +16,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 using namespace std;
 
+namespace hap {
+
 class Cache {
 public: /* private */
     vector<CSet *> sets;
@@ -31,22 +33,35 @@ public: /* private */
     
     Threshold threshold;
     Threshold staticThresholds[SAMPLE_SET_TYPES];
+    llu histo; //query counter at the last progress report
     
 public:
     /*
-     * set initial value for cache parameters
+     * set initial value for cache parameters; size in KB and blockSize in bytes
      */
-    Cache(int size, int associativity);
+    Cache(int size, int associativity, int blockSize);
     
     /*
      * sends query to the specified cache
      */
-    QRet query(llu addr, bool l1EvictDirty, bool isNVM, bool affectReadHitRatio, string value);
+    QRet query(llu addr, bool l1EvictDirty, bool isNVM, bool affectReadHitRatio, const BlockValue& value);
     
     /*
      * monitor threshold and reset sample counters
      */
     void samplePoint();
+    
+    /*
+     * writes the statistics, the thresholds and every set to a snapshot
+     */
+    void save(SnapshotWriter& snapshot) const;
+    
+    /*
+     * reads them back into a cache just constructed with the same geometry
+     */
+    void load(SnapshotReader& snapshot);
 };
 
+} // namespace hap
+
 #endif /* Cache_h */
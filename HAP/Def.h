@@ -14,6 +14,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include <vector>
 #include <algorithm>
 #include <string>
+#include "BlockValue.h"
+#include "Snapshot.h"
 
 #define GENERATE_ENERGY_TRACE
 
@@ -28,6 +30,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #define SAMPLE_POINT 100000000 //every 100 million instructions
 #define L_RATIO 3
 
+namespace hap {
+
 typedef long long unsigned llu;
 
 struct BitLen {
@@ -40,7 +44,7 @@ struct CBlock {
     bool isNVM;
     bool isDirty;
     bool isChance;
-    std::string value;
+    BlockValue value;
 };
 
 struct QRet { //what query returns
@@ -54,4 +58,6 @@ struct Threshold {
     int lo;
 };
 
+} // namespace hap
+
 #endif /* Def_h */
@@ -0,0 +1,230 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "HapRun.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include "Cache.h"
+#include <cassert>
+#include "TraceReader.h"
+#include "TimeSampler.h"
+
+#define LINE_WIDTH 48
+#define PRINT_VERSION cout << HAP_VERSION << endl
+#define PRINT_MULT(char, count) (cout << setfill(char) << setw(count) << "")
+
+using namespace std;
+using namespace hap;
+
+static time_t start;
+static llu ignoreEnd;
+static Cache* cache;
+static ofstream out;
+static TraceReader* trace;
+static TimeSampler* sampler; //nullptr unless time sampling
+
+static void calculateRange();
+static void postReport();
+static void preReport(const RunConfig& config);
+
+/*
+ * saves the cache to config.checkpointPath
+ */
+static void saveState(const RunConfig& config) {
+    SnapshotWriter snapshot(config.checkpointPath, config, cache->queryCounter);
+    cache->save(snapshot);
+    snapshot.close();
+}
+
+/*
+ * loads the cache from config.restorePath and skips the queries already simulated
+ */
+static void restoreState(const RunConfig& config) {
+    SnapshotReader snapshot(config.restorePath, config);
+    cache->load(snapshot);
+    snapshot.close();
+    skipQueries(trace, snapshot.getQueryOffset());
+}
+
+/*
+ * feeds the whole trace to the cache; compiled once with and once without the energy trace
+ */
+template<bool EnergyTrace>
+static void replay(const RunConfig& config) {
+    TraceRecord record;
+    //FORMAT: %d   %d   %s   %s   %s
+
+    while (trace->next(record)) {
+
+        if (record.type == TRACE_UPGRADE) {
+            continue; //ignore Upgrade
+        }
+
+        llu inp = record.addr;
+        const BlockValue& value = record.value;
+
+        //send query
+        bool isDirty = (record.type == TRACE_EVICT_DIRTY);
+        bool affectReadHitRatio = ((record.type == TRACE_READ) || (record.type == TRACE_WRITE) || (record.type == TRACE_FETCH));
+        bool isNVM = true; //TODO
+        //between the windows of time sampling, the queries only warm the cache up and carry no value
+        QRet ret = ( (sampler == nullptr) || sampler->detailed() ) ? cache->query(inp, isDirty, isNVM, affectReadHitRatio, value) : cache->query(inp, isDirty, isNVM, affectReadHitRatio, BlockValue());
+        
+        //fill timer and address with 0 placeholder
+        if (EnergyTrace && !ret.hit) {
+            //miss
+            out << "0 R 0 " << value << endl;
+            
+            if (ret.dirtyEviction) {
+                out << "0 W 0 " << ret.evictedBlock.value << endl;
+            }
+                
+        }
+
+        if ( (config.checkpointEvery != 0) && (cache->queryCounter % config.checkpointEvery == 0) ) {
+            saveState(config);
+        }
+
+        if (sampler != nullptr) {
+            sampler->advance(cache->writebackCount, cache->readHitCount, cache->readCount);
+            
+            if (sampler->done()) {
+                break; //the rest of the trace is left unread
+            }
+            
+        }
+
+    }
+    
+    if (!config.checkpointPath.empty()) {
+        saveState(config);
+    }
+    
+}
+
+int runHap(const RunConfig& config) {
+    
+    if (!config.timeTracePath.empty()) {
+        out.open(config.timeTracePath);
+        
+        if (!out.is_open()) {
+            cout << "Specified File Cannot Be Opened\n";
+            exit(EXIT_FAILURE);
+        }
+        
+    }
+    
+    //the trace is read from config.tracePath if given, and from stdin otherwise or when a sweep streams it there
+    trace = openTrace(config.traceSource());
+    preReport(config);
+    calculateRange();
+    start = time(NULL);
+
+    //initialize cache object
+    PRINT_MULT('-', LINE_WIDTH / 2 - 3);
+    cout << " HAP ";
+    PRINT_MULT('-', LINE_WIDTH / 2 - 2);
+    cout << endl;
+    cache = new Cache(config.cacheKiB, config.associativity, config.blockBytes);
+
+    if (config.sampleLength != 0) {
+        
+        if ( out.is_open() || !config.checkpointPath.empty() || !config.restorePath.empty() ) {
+            cout << "Time Sampling Cannot Be Combined With The Energy Trace Or Snapshots\n";
+            exit(EXIT_FAILURE);
+        }
+        
+        sampler = new TimeSampler(config);
+    }
+
+    if (!config.restorePath.empty()) {
+        restoreState(config);
+    }
+
+    if (out.is_open()) {
+        replay<true>(config);
+    } else {
+        replay<false>(config);
+    }
+    
+    ignoreEnd = trace->getTrailingIgnored();
+    delete trace;
+    
+    cout << "(LAST " << ignoreEnd << " LINES WERE IGNORED)" << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl << endl;
+
+    //print results
+    postReport();
+    
+    if (sampler != nullptr) {
+        sampler->print(cout);
+        PRINT_MULT('=', LINE_WIDTH);
+        cout << endl;
+    }
+    
+    return 0;
+}
+
+static void preReport(const RunConfig& config) {
+    PRINT_VERSION;
+    PRINT_MULT('=', LINE_WIDTH - 9);
+    cout << "CONSTANTS";
+    cout << endl;
+    cout << "Cache Size = \t\t" << config.cacheKiB << " (KiB)\n";
+    PRINT_MULT('_', LINE_WIDTH);
+    cout << endl;
+    cout << "Associativity = \t" << config.associativity << endl;
+    PRINT_MULT('_', LINE_WIDTH);
+    cout << endl;
+    cout << "Block Size = \t\t" << config.blockBytes << " (B)\n";
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl;
+}
+
+static void postReport() {
+    llu hits, misses, reads, readHits, writebacks;
+    hits = cache->hitCount;
+    misses = cache->missCount;
+    reads = cache->readCount;
+    readHits = cache->readHitCount;
+    writebacks = cache->writebackCount;
+    
+    PRINT_MULT('=', LINE_WIDTH - 7);
+    cout << "RESULTS\n";
+    PRINT_MULT('_', LINE_WIDTH - 7 - 8);
+    cout << endl;
+    cout << "MISS RATE: \t\t" << fixed << setprecision(5) << 1.0 * misses / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * misses / (hits + misses) << "%" << endl;
+    cout << "HIT RATE: \t\t" << fixed << setprecision(5) << 1.0 * hits / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * hits / (hits + misses) << "%" <<  endl;
+    cout << "READ HIT COUNT: \t\t" << fixed << setprecision(5) << readHits << endl;
+    cout << "TOTAL READ ACCESS COUNT: \t\t" << reads << endl;
+    cout << "READ HIT RATIO: \t\t" << fixed << setprecision(5) << 1.0 * readHits / reads << endl;
+    cout << "WRITE BACK COUNT: \t" << writebacks << endl;
+    cout << "TOTAL QUERIES: \t" << hits + misses << endl;
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+    
+    time_t end = time(NULL);
+    time_t total = end - start;
+    cout << "TOTAL TIME: \t\t" << setfill('0') << setw(2) << total / 3600 << ":" << setw(2) << (total % 3600) / 60 << ":" << setw(2) << (total % 60) << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl;
+}
+
+static void calculateRange() {
+    cout << "(FIRST " << trace->getLeadingIgnored() << " LINES WERE IGNORED)" << endl;
+}
@@ -8,50 +8,18 @@ Please cite the following paper when using the provided source codes:
 M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
 */
 
-#include "CacheBlock.h"
-
-CacheBlock::CacheBlock(int blockOffset): Block(blockOffset), former(nullptr), dirty(false) {
-    
-}
-
-CacheBlock::CacheBlock(const CacheBlock& src): Block(src), dirty(src.dirty), former(nullptr) {
-}
-
-CacheBlock::~CacheBlock() {
-    
-    if (former != nullptr) {
-        delete former;
-    }
-    
-}
-
-void CacheBlock::setDirty() {
-    dirty = true;
-}
-
-bool CacheBlock::isDirty() const {
-    
-    if (isValid == false) {
-        return false;
-    }
-    
-    return dirty;
-}
-
-const CacheBlock* CacheBlock::set(lli newAddr, bool newDirty, std::string value) {
-    
-    if (former != nullptr) {
-        delete former;
-    }
-    
-    former = new CacheBlock(*this);
-    content.addr = newAddr;
-    content.value = value;
-    dirty = newDirty;
-    isValid = true;
-    return former;
-}
-
-void CacheBlock::setVal(std::string value) {
-    content.value = value;
-}
\ No newline at end of file
+
+
+#ifndef HapRun_h
+#define HapRun_h
+
+#include "RunConfig.h"
+
+#define HAP_VERSION "HAP v0.9" //printed in the report; bump it when the results of the model change
+
+/*
+ * simulates HAP on a trace and prints the report; config.timeTracePath enables the energy trace
+ */
+int runHap(const RunConfig& config);
+
+#endif /* HapRun_h */
@@ -0,0 +1,317 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+#include "BinaryTrace.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#define BINARY_TRACE_CHUNK_PADDING 32 //decoding may overshoot a corrupt chunk by a few bytes
+
+static inline void put32(uint8_t* dst, uint32_t value) {
+
+    for (int i = 0; i < 4; i++) {
+        dst[i] = (uint8_t) (value >> (8 * i));
+    }
+
+}
+
+static inline void put64(uint8_t* dst, uint64_t value) {
+
+    for (int i = 0; i < 8; i++) {
+        dst[i] = (uint8_t) (value >> (8 * i));
+    }
+
+}
+
+static inline uint32_t get32(const uint8_t* src) {
+    uint32_t value = 0;
+
+    for (int i = 0; i < 4; i++) {
+        value |= ((uint32_t) src[i]) << (8 * i);
+    }
+
+    return value;
+}
+
+static inline uint64_t get64(const uint8_t* src) {
+    uint64_t value = 0;
+
+    for (int i = 0; i < 8; i++) {
+        value |= ((uint64_t) src[i]) << (8 * i);
+    }
+
+    return value;
+}
+
+static inline void putVarint(std::vector<uint8_t>& dst, uint64_t value) {
+
+    while (value >= 0x80) {
+        dst.push_back((uint8_t) (value | 0x80));
+        value >>= 7;
+    }
+
+    dst.push_back((uint8_t) value);
+}
+
+static inline uint64_t getVarint(const uint8_t*& src) {
+    uint64_t value = 0;
+    int shift = 0;
+
+    while (*src & 0x80) {
+        value |= ((uint64_t) (*src & 0x7f)) << shift;
+        shift += 7;
+        src++;
+    }
+
+    value |= ((uint64_t) *src) << shift;
+    src++;
+    return value;
+}
+
+static inline uint64_t zigzag(uint64_t delta) {
+    return (delta << 1) ^ (uint64_t) (((int64_t) delta) >> 63);
+}
+
+static inline uint64_t unzigzag(uint64_t value) {
+    return (value >> 1) ^ (~(value & 1) + 1);
+}
+
+/**
+ * Encode the valid words of the value; they are read back as the first words of the block
+ */
+static void encodeValue(const BlockValue& value, std::vector<uint8_t>& dst) {
+    putVarint(dst, ((uint64_t) __builtin_popcount(value.validWords)) << 1);
+
+    for (int i = 0; i < BLOCK_VALUE_WORDS; i++) {
+
+        if (value.hasWord(i)) {
+            putVarint(dst, value.getWord(i));
+        }
+
+    }
+
+}
+
+static void encodeHeader(uint8_t* dst, const BinaryTraceHeader& header) {
+    memset(dst, 0, BINARY_TRACE_HEADER_SIZE);
+    memcpy(dst, BINARY_TRACE_MAGIC, BINARY_TRACE_MAGIC_SIZE);
+    put32(dst + 8, header.version);
+    put32(dst + 12, BINARY_TRACE_HEADER_SIZE);
+    put64(dst + 16, header.recordCount);
+    put64(dst + 24, header.leadingIgnored);
+    put64(dst + 32, header.trailingIgnored);
+    put64(dst + 40, header.chunkCount);
+}
+
+BinaryTraceWriter::BinaryTraceWriter(const std::string& path): chunkRecords(0), prevAddr(0), prevPc(0) {
+    file = fopen(path.c_str(), "wb");
+
+    if (file == nullptr) {
+        std::cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+
+    header.version = BINARY_TRACE_VERSION;
+    header.recordCount = 0;
+    header.leadingIgnored = 0;
+    header.trailingIgnored = 0;
+    header.chunkCount = 0;
+    writeHeader(); //placeholder; rewritten by close()
+}
+
+BinaryTraceWriter::~BinaryTraceWriter() {
+
+    if (file != nullptr) {
+        close(header.leadingIgnored, header.trailingIgnored);
+    }
+
+}
+
+void BinaryTraceWriter::writeHeader() {
+    uint8_t raw[BINARY_TRACE_HEADER_SIZE];
+    encodeHeader(raw, header);
+    fwrite(raw, 1, BINARY_TRACE_HEADER_SIZE, file);
+}
+
+void BinaryTraceWriter::write(const TraceRecord& record) {
+    mainStream.push_back((uint8_t) record.type);
+    putVarint(mainStream, zigzag(record.addr - prevAddr));
+    putVarint(mainStream, zigzag(record.pc - prevPc));
+    encodeValue(record.value, valueStream);
+    prevAddr = record.addr;
+    prevPc = record.pc;
+    header.recordCount++;
+    chunkRecords++;
+
+    if (chunkRecords == BINARY_TRACE_CHUNK_RECORDS) {
+        flushChunk();
+    }
+
+}
+
+void BinaryTraceWriter::flushChunk() {
+    uint8_t raw[BINARY_TRACE_CHUNK_HEADER_SIZE];
+    put32(raw, chunkRecords);
+    put32(raw + 4, (uint32_t) mainStream.size());
+    put32(raw + 8, (uint32_t) valueStream.size());
+    fwrite(raw, 1, BINARY_TRACE_CHUNK_HEADER_SIZE, file);
+
+    if (chunkRecords == 0) {
+        return; //terminator
+    }
+
+    fwrite(mainStream.data(), 1, mainStream.size(), file);
+    fwrite(valueStream.data(), 1, valueStream.size(), file);
+    header.chunkCount++;
+    mainStream.clear();
+    valueStream.clear();
+    chunkRecords = 0;
+    prevAddr = 0;
+    prevPc = 0;
+}
+
+void BinaryTraceWriter::close(uint64_t leadingIgnored, uint64_t trailingIgnored) {
+
+    if (chunkRecords != 0) {
+        flushChunk();
+    }
+
+    flushChunk(); //terminator
+    header.leadingIgnored = leadingIgnored;
+    header.trailingIgnored = trailingIgnored;
+
+    if (fseek(file, 0, SEEK_SET) != 0) {
+        std::cout << "Binary Trace Must Be Written To A Seekable File\n";
+        exit(EXIT_FAILURE);
+    }
+
+    writeHeader();
+
+    if (fclose(file) != 0) {
+        std::cout << "Binary Trace Cannot Be Written\n";
+        exit(EXIT_FAILURE);
+    }
+
+    file = nullptr;
+}
+
+const BinaryTraceHeader& BinaryTraceWriter::getHeader() const {
+    return header;
+}
+
+BinaryTraceReader::BinaryTraceReader(FILE* initFile): file(initFile), mainPos(nullptr), valuePos(nullptr), remaining(0), prevAddr(0), prevPc(0) {
+    uint8_t raw[BINARY_TRACE_HEADER_SIZE];
+
+    if ( (fread(raw, 1, BINARY_TRACE_HEADER_SIZE, file) != BINARY_TRACE_HEADER_SIZE) || (memcmp(raw, BINARY_TRACE_MAGIC, BINARY_TRACE_MAGIC_SIZE) != 0) ) {
+        std::cout << "Bad Binary Trace Header\n";
+        exit(EXIT_FAILURE);
+    }
+
+    header.version = get32(raw + 8);
+
+    if ( (header.version != BINARY_TRACE_VERSION) || (get32(raw + 12) != BINARY_TRACE_HEADER_SIZE) ) {
+        std::cout << "Unsupported Binary Trace Version " << header.version << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    header.recordCount = get64(raw + 16);
+    header.leadingIgnored = get64(raw + 24);
+    header.trailingIgnored = get64(raw + 32);
+    header.chunkCount = get64(raw + 40);
+    leadingIgnored = header.leadingIgnored;
+    trailingIgnored = header.trailingIgnored;
+}
+
+BinaryTraceReader::~BinaryTraceReader() {
+
+    if (file != stdin) {
+        fclose(file);
+    }
+
+}
+
+bool BinaryTraceReader::loadChunk() {
+    uint8_t raw[BINARY_TRACE_CHUNK_HEADER_SIZE];
+
+    if (fread(raw, 1, BINARY_TRACE_CHUNK_HEADER_SIZE, file) != BINARY_TRACE_CHUNK_HEADER_SIZE) {
+        std::cout << "Binary Trace Is Truncated\n";
+        exit(EXIT_FAILURE);
+    }
+
+    remaining = get32(raw);
+
+    if (remaining == 0) {
+        return false;
+    }
+
+    size_t mainSize = get32(raw + 4);
+    size_t valueSize = get32(raw + 8);
+    chunk.resize(mainSize + valueSize + BINARY_TRACE_CHUNK_PADDING);
+
+    if (fread(chunk.data(), 1, mainSize + valueSize, file) != mainSize + valueSize) {
+        std::cout << "Binary Trace Is Truncated\n";
+        exit(EXIT_FAILURE);
+    }
+
+    memset(chunk.data() + mainSize + valueSize, 0, BINARY_TRACE_CHUNK_PADDING);
+    mainPos = chunk.data();
+    valuePos = chunk.data() + mainSize;
+    prevAddr = 0;
+    prevPc = 0;
+    return true;
+}
+
+bool BinaryTraceReader::next(TraceRecord& record) {
+
+    if ( (remaining == 0) && !loadChunk() ) {
+        return false;
+    }
+
+    remaining--;
+    record.type = (TraceType) *mainPos++;
+    prevAddr += unzigzag(getVarint(mainPos));
+    prevPc += unzigzag(getVarint(mainPos));
+    record.addr = prevAddr;
+    record.pc = prevPc;
+
+    uint64_t valueHead = getVarint(valuePos);
+
+    if (valueHead & 1) {
+        const char* text = (const char*) valuePos;
+        valuePos += valueHead >> 1;
+
+        if (!parseBlockValue(text, (const char*) valuePos, record.value)) {
+            std::cout << "Binary Trace Is Corrupted\n";
+            exit(EXIT_FAILURE);
+        }
+
+    } else {
+
+        if ((valueHead >> 1) > BLOCK_VALUE_WORDS) {
+            std::cout << "Binary Trace Is Corrupted\n";
+            exit(EXIT_FAILURE);
+        }
+
+        record.value.clear();
+
+        for (int i = 0; i < (int) (valueHead >> 1); i++) {
+            record.value.setWord(i, getVarint(valuePos));
+        }
+
+    }
+
+    return true;
+}
+
+const BinaryTraceHeader& BinaryTraceReader::getHeader() const {
+    return header;
+}
@@ -0,0 +1,121 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+#ifndef BinaryTrace_h
+#define BinaryTrace_h
+
+#include "TraceReader.h"
+#include <cstdio>
+#include <vector>
+
+/*
+ * Binary trace layout (all integers little-endian)
+ * header: magic[8], version (u32), header size (u32), record count, leading ignored, trailing ignored, chunk count (u64 each)
+ * chunks: record count, main stream size, value stream size (u32 each), main stream, value stream
+ * the last chunk has a record count of zero
+ *
+ * main stream, per record: type byte, zigzag varint of address delta, zigzag varint of pc delta
+ * value stream, per record: varint (word count << 1) followed by the valid words as varints; a value may also be
+ * stored as varint (byte count << 1 | 1) followed by its text, which is decoded like the value of a text trace
+ * deltas restart at the beginning of each chunk, so chunks decode independently
+ */
+#define BINARY_TRACE_MAGIC "\x89ICDTRC\n"
+#define BINARY_TRACE_MAGIC_SIZE 8
+#define BINARY_TRACE_VERSION 1
+#define BINARY_TRACE_HEADER_SIZE 48
+#define BINARY_TRACE_CHUNK_HEADER_SIZE 12
+#define BINARY_TRACE_CHUNK_RECORDS 65536
+
+struct BinaryTraceHeader {
+    uint32_t version;
+    uint64_t recordCount;
+    uint64_t leadingIgnored;
+    uint64_t trailingIgnored;
+    uint64_t chunkCount;
+};
+
+class BinaryTraceWriter {
+private:
+    FILE* file;
+    BinaryTraceHeader header;
+    std::vector<uint8_t> mainStream;
+    std::vector<uint8_t> valueStream;
+    uint32_t chunkRecords;
+    uint64_t prevAddr;
+    uint64_t prevPc;
+
+    /**
+     * Write the buffered records as one chunk
+     */
+    void flushChunk();
+
+    void writeHeader();
+
+public:
+    /**
+     * Constructor
+     * @param path Path of the binary trace being created
+     */
+    BinaryTraceWriter(const std::string& path);
+
+    /**
+     * Destructor; closes the file in case
+     */
+    ~BinaryTraceWriter();
+
+    /**
+     * Append a record
+     */
+    void write(const TraceRecord& record);
+
+    /**
+     * Write the remaining records and the final header, then close the file
+     */
+    void close(uint64_t leadingIgnored, uint64_t trailingIgnored);
+
+    const BinaryTraceHeader& getHeader() const;
+};
+
+class BinaryTraceReader: public TraceReader {
+private:
+    FILE* file;
+    BinaryTraceHeader header;
+    std::vector<uint8_t> chunk;
+    const uint8_t* mainPos;
+    const uint8_t* valuePos;
+    uint32_t remaining;
+    uint64_t prevAddr;
+    uint64_t prevPc;
+
+    /**
+     * Read the next chunk into memory
+     * @return False if the terminating chunk was reached
+     */
+    bool loadChunk();
+
+public:
+    /**
+     * Constructor; reads and validates the header
+     * @param initFile Trace positioned at its header; closed by the destructor unless it is stdin
+     */
+    BinaryTraceReader(FILE* initFile);
+
+    /**
+     * Destructor; closes the file
+     */
+    virtual ~BinaryTraceReader();
+
+    virtual bool next(TraceRecord& record);
+
+    const BinaryTraceHeader& getHeader() const;
+};
+
+#endif /* BinaryTrace_h */
@@ -0,0 +1,110 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "BlockValue.h"
+
+/**
+ * Value of every hex digit, -1 for any other character; a table since digits and letters are mixed at random
+ */
+struct HexTable {
+    int8_t digit[256];
+
+    HexTable() {
+        memset(digit, -1, sizeof(digit));
+
+        for (int i = 0; i < 10; i++) {
+            digit['0' + i] = i;
+        }
+
+        for (int i = 0; i < 6; i++) {
+            digit['a' + i] = 10 + i;
+            digit['A' + i] = 10 + i;
+        }
+
+    }
+};
+
+static const HexTable hexTable;
+
+static inline int hexDigit(char c) {
+    return hexTable.digit[(unsigned char) c];
+}
+
+static inline bool isBlank(char c) {
+    return (c == ' ') || (c == '\t') || (c == '\r');
+}
+
+bool parseBlockValue(const char* text, const char* textEnd, BlockValue& value) {
+    int wordCount = 0;
+    value.clear();
+
+    while (true) {
+
+        while ( (text != textEnd) && isBlank(*text) ) {
+            text++;
+        }
+
+        if (text == textEnd) {
+            return true;
+        }
+
+        if (wordCount == BLOCK_VALUE_WORDS) {
+            return false;
+        }
+
+        const char* digits = text;
+        uint64_t word = 0;
+        int digit;
+
+        while ( (text != textEnd) && ((digit = hexDigit(*text)) >= 0) ) {
+            word = (word << 4) | digit;
+            text++;
+        }
+
+        if ( (text == digits) || (text - digits > 16) || ((text != textEnd) && !isBlank(*text)) ) {
+            return false;
+        }
+
+        value.setWord(wordCount, word);
+        wordCount++;
+    }
+
+}
+
+std::ostream& operator<<(std::ostream& out, const BlockValue& value) {
+    static const char digits[] = "0123456789abcdef";
+    char text[BLOCK_VALUE_WORDS * 17];
+    char* pos = text;
+
+    for (int i = 0; i < BLOCK_VALUE_WORDS; i++) {
+
+        if (!value.hasWord(i)) {
+            continue;
+        }
+
+        uint64_t word = value.getWord(i);
+        int shift = 60;
+
+        while ( (shift > 0) && ((word >> shift) == 0) ) {
+            shift -= 4;
+        }
+
+        *pos++ = ' ';
+
+        for (; shift >= 0; shift -= 4) {
+            *pos++ = digits[(word >> shift) & 0xf];
+        }
+
+    }
+
+    return out.write(text, pos - text);
+}
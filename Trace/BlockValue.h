@@ -0,0 +1,68 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef BlockValue_h
+#define BlockValue_h
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#define BLOCK_VALUE_BYTES 64
+#define BLOCK_VALUE_WORDS 8
+
+/**
+ * Data of a 64-byte block, as 64-bit words in host byte order; a word is only meaningful if its bit is set in validWords
+ */
+struct BlockValue {
+    std::array<uint8_t, BLOCK_VALUE_BYTES> bytes;
+    uint8_t validWords; //bit i is set if word i was given by the trace
+
+    BlockValue(): bytes(), validWords(0) {
+
+    }
+
+    uint64_t getWord(int index) const {
+        uint64_t word;
+        memcpy(&word, bytes.data() + index * sizeof(uint64_t), sizeof(uint64_t));
+        return word;
+    }
+
+    void setWord(int index, uint64_t word) {
+        memcpy(bytes.data() + index * sizeof(uint64_t), &word, sizeof(uint64_t));
+        validWords |= (uint8_t) (1 << index);
+    }
+
+    bool hasWord(int index) const {
+        return (validWords >> index) & 1;
+    }
+
+    void clear() {
+        validWords = 0;
+    }
+};
+
+/**
+ * Decode the value field of a trace line, a list of at most BLOCK_VALUE_WORDS hex words separated by blanks
+ * @param text The field; may be empty
+ * @param textEnd End of the field
+ * @return False if the field is malformed
+ */
+bool parseBlockValue(const char* text, const char* textEnd, BlockValue& value);
+
+/**
+ * Print the valid words as the trace gives them: each in lowercase hex, preceded by a space
+ */
+std::ostream& operator<<(std::ostream& out, const BlockValue& value);
+
+#endif /* BlockValue_h */
@@ -0,0 +1,529 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "CompressedTrace.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef TRACE_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef TRACE_HAVE_LZMA
+#include <lzma.h>
+#endif
+
+#ifdef TRACE_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+[[noreturn]] static void fail(const char* message) {
+    std::cout << message << "\n";
+    exit(EXIT_FAILURE);
+}
+
+bool mayBeCompressed(int first) {
+    return (first == 0x1f) || (first == 0x28) || (first == 0xfd);
+}
+
+TraceCompression detectCompression(const unsigned char* magic, size_t size) {
+    if ( (size >= 2) && (magic[0] == 0x1f) && (magic[1] == 0x8b) ) {
+        return TRACE_GZIP;
+    }
+
+    if ( (size >= 4) && (memcmp(magic, "\x28\xb5\x2f\xfd", 4) == 0) ) {
+        return TRACE_ZSTD;
+    }
+
+    if ( (size >= 6) && (memcmp(magic, "\xfd" "7zXZ\0", 6) == 0) ) {
+        return TRACE_XZ;
+    }
+
+    return TRACE_PLAIN;
+}
+
+/**
+ * Producer of the bytes behind a stream returned by openDecompressed()
+ */
+class Decompressor {
+protected:
+    FILE* file; //nullptr if the input is not read through a stream
+    std::vector<unsigned char> prefix;
+    size_t prefixPos;
+
+    /**
+     * Read raw input; the prefix comes first, then the file
+     * @return Number of bytes read; zero at the end of the input
+     */
+    size_t readInput(unsigned char* data, size_t size) {
+        if (prefixPos < prefix.size()) {
+            size_t count = std::min(size, prefix.size() - prefixPos);
+            memcpy(data, prefix.data() + prefixPos, count);
+            prefixPos += count;
+            return count;
+        }
+
+        return fread(data, 1, size, file);
+    }
+
+public:
+    Decompressor(FILE* initFile, const unsigned char* initPrefix, size_t prefixSize): file(initFile), prefixPos(0) {
+        if (prefixSize != 0) {
+            prefix.assign(initPrefix, initPrefix + prefixSize);
+        }
+    }
+
+    virtual ~Decompressor() {
+        if ( (file != nullptr) && (file != stdin) ) {
+            fclose(file);
+        }
+    }
+
+    /**
+     * Fill data with decompressed bytes
+     * @return Number of bytes produced; zero at the end of the trace
+     */
+    virtual size_t read(char* data, size_t size) = 0;
+};
+
+class PlainDecompressor: public Decompressor {
+public:
+    PlainDecompressor(FILE* initFile, const unsigned char* initPrefix, size_t prefixSize): Decompressor(initFile, initPrefix, prefixSize) {
+
+    }
+
+    virtual size_t read(char* data, size_t size) {
+        return readInput((unsigned char*) data, size);
+    }
+};
+
+#ifdef TRACE_HAVE_ZLIB
+class GzipDecompressor: public Decompressor {
+private:
+    z_stream stream;
+    std::vector<unsigned char> input;
+    bool inputEnd;
+    bool memberEnd; //concatenated gzip members are decompressed back to back
+
+public:
+    GzipDecompressor(FILE* initFile, const unsigned char* initPrefix, size_t prefixSize): Decompressor(initFile, initPrefix, prefixSize), input(COMPRESSED_TRACE_BUFFER_SIZE), inputEnd(false), memberEnd(false) {
+        memset(&stream, 0, sizeof(stream));
+
+        if (inflateInit2(&stream, 15 + 16) != Z_OK) {
+            fail("Gzip Decompressor Cannot Be Initialized");
+        }
+    }
+
+    virtual ~GzipDecompressor() {
+        inflateEnd(&stream);
+    }
+
+    virtual size_t read(char* data, size_t size) {
+        stream.next_out = (Bytef*) data;
+        stream.avail_out = size;
+
+        while (stream.avail_out > 0) {
+            if ( (stream.avail_in == 0) && !inputEnd ) {
+                stream.next_in = input.data();
+                stream.avail_in = readInput(input.data(), input.size());
+                inputEnd = (stream.avail_in == 0);
+            }
+
+            if ( inputEnd && (stream.avail_in == 0) && memberEnd ) {
+                break;
+            }
+
+            int status = inflate(&stream, Z_NO_FLUSH);
+
+            if (status == Z_STREAM_END) {
+                memberEnd = true;
+                inflateReset(&stream);
+            }
+            else if (status == Z_OK) {
+                memberEnd = false;
+            }
+            else {
+                fail( (inputEnd && (status == Z_BUF_ERROR)) ? "Gzip Trace Is Truncated" : "Gzip Trace Is Corrupted" );
+            }
+        }
+
+        return size - stream.avail_out;
+    }
+};
+#endif
+
+#ifdef TRACE_HAVE_LZMA
+class XzDecompressor: public Decompressor {
+private:
+    lzma_stream stream;
+    std::vector<unsigned char> input;
+    bool inputEnd;
+    bool finished;
+
+public:
+    XzDecompressor(FILE* initFile, const unsigned char* initPrefix, size_t prefixSize): Decompressor(initFile, initPrefix, prefixSize), stream(LZMA_STREAM_INIT), input(COMPRESSED_TRACE_BUFFER_SIZE), inputEnd(false), finished(false) {
+        if (lzma_stream_decoder(&stream, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) {
+            fail("Xz Decompressor Cannot Be Initialized");
+        }
+    }
+
+    virtual ~XzDecompressor() {
+        lzma_end(&stream);
+    }
+
+    virtual size_t read(char* data, size_t size) {
+        stream.next_out = (uint8_t*) data;
+        stream.avail_out = size;
+
+        while ( (stream.avail_out > 0) && !finished ) {
+            if ( (stream.avail_in == 0) && !inputEnd ) {
+                stream.next_in = input.data();
+                stream.avail_in = readInput(input.data(), input.size());
+                inputEnd = (stream.avail_in == 0);
+            }
+
+            lzma_ret status = lzma_code(&stream, inputEnd ? LZMA_FINISH : LZMA_RUN);
+
+            if (status == LZMA_STREAM_END) {
+                finished = true;
+            }
+            else if (status != LZMA_OK) {
+                fail( (status == LZMA_BUF_ERROR) ? "Xz Trace Is Truncated" : "Xz Trace Is Corrupted" );
+            }
+        }
+
+        return size - stream.avail_out;
+    }
+};
+#endif
+
+#ifdef TRACE_HAVE_ZSTD
+class ZstdDecompressor: public Decompressor {
+private:
+    ZSTD_DStream* stream;
+    std::vector<unsigned char> input;
+    ZSTD_inBuffer inBuffer;
+    bool inputEnd;
+    size_t hint; //zero once the last frame is complete
+
+public:
+    ZstdDecompressor(FILE* initFile, const unsigned char* initPrefix, size_t prefixSize): Decompressor(initFile, initPrefix, prefixSize), input(COMPRESSED_TRACE_BUFFER_SIZE), inputEnd(false), hint(1) {
+        stream = ZSTD_createDStream();
+
+        if ( (stream == nullptr) || ZSTD_isError(ZSTD_initDStream(stream)) ) {
+            fail("Zstd Decompressor Cannot Be Initialized");
+        }
+
+        inBuffer.src = input.data();
+        inBuffer.size = 0;
+        inBuffer.pos = 0;
+    }
+
+    virtual ~ZstdDecompressor() {
+        ZSTD_freeDStream(stream);
+    }
+
+    virtual size_t read(char* data, size_t size) {
+        ZSTD_outBuffer outBuffer = {data, size, 0};
+
+        while (outBuffer.pos < outBuffer.size) {
+            if ( (inBuffer.pos == inBuffer.size) && !inputEnd ) {
+                inBuffer.size = readInput(input.data(), input.size());
+                inBuffer.pos = 0;
+                inputEnd = (inBuffer.size == 0);
+            }
+
+            size_t produced = outBuffer.pos;
+            size_t consumed = inBuffer.pos;
+            size_t status = ZSTD_decompressStream(stream, &outBuffer, &inBuffer);
+
+            if (ZSTD_isError(status)) {
+                fail("Zstd Trace Is Corrupted");
+            }
+
+            //nothing left to flush and nothing left to read
+            if ( inputEnd && (outBuffer.pos == produced) && (inBuffer.pos == consumed) ) {
+                if (hint != 0) {
+                    fail("Zstd Trace Is Truncated");
+                }
+
+                break;
+            }
+
+            hint = status;
+        }
+
+        return outBuffer.pos;
+    }
+};
+
+/**
+ * Decompresses the frames of a memory-mapped zstd trace on a pool of threads; a bounded window of frames is in flight
+ * and the consumer takes them back in order
+ */
+class ParallelZstdDecompressor: public Decompressor {
+private:
+    unsigned char* mapping;
+    size_t mappingSize;
+    std::vector<std::pair<size_t, size_t> > frames; //offset and size of each frame
+    std::vector<std::vector<char> > slots; //frame i is decompressed into slot i % window
+    std::vector<bool> ready;
+    size_t window;
+    size_t claimed; //frames handed to the workers so far
+    size_t delivered; //frames fully read by the consumer so far
+    size_t deliveredPos;
+    bool stopping;
+    std::mutex lock;
+    std::condition_variable readyCond;
+    std::condition_variable spaceCond;
+    std::vector<std::thread> workers;
+
+    void decompressFrame(ZSTD_DCtx* context, size_t frame, std::vector<char>& output) {
+        const unsigned char* src = mapping + frames[frame].first;
+        size_t srcSize = frames[frame].second;
+        unsigned long long contentSize = ZSTD_getFrameContentSize(src, srcSize);
+
+        if ( (contentSize != ZSTD_CONTENTSIZE_UNKNOWN) && (contentSize != ZSTD_CONTENTSIZE_ERROR) ) {
+            output.resize(contentSize);
+
+            if (ZSTD_decompressDCtx(context, output.data(), output.size(), src, srcSize) != contentSize) {
+                fail("Zstd Trace Is Corrupted");
+            }
+
+            return;
+        }
+
+        //the frame does not record its size; grow the output as needed
+        ZSTD_DCtx_reset(context, ZSTD_reset_session_only);
+        ZSTD_inBuffer inBuffer = {src, srcSize, 0};
+        size_t used = 0;
+        size_t hint = 1;
+        output.resize(std::max(ZSTD_DStreamOutSize(), 4 * srcSize));
+
+        while (hint != 0) {
+            if (used == output.size()) {
+                output.resize(2 * output.size());
+            }
+
+            ZSTD_outBuffer outBuffer = {output.data() + used, output.size() - used, 0};
+            hint = ZSTD_decompressStream(context, &outBuffer, &inBuffer);
+
+            if (ZSTD_isError(hint)) {
+                fail("Zstd Trace Is Corrupted");
+            }
+
+            //room was left but the input ran out before the end of the frame
+            if ( (hint != 0) && (inBuffer.pos == inBuffer.size) && (outBuffer.pos < outBuffer.size) ) {
+                fail("Zstd Trace Is Truncated");
+            }
+
+            used += outBuffer.pos;
+        }
+
+        output.resize(used);
+    }
+
+    void work() {
+        ZSTD_DCtx* context = ZSTD_createDCtx();
+        std::unique_lock<std::mutex> guard(lock);
+
+        while (true) {
+            spaceCond.wait(guard, [this] { return stopping || (claimed == frames.size()) || (claimed < delivered + window); });
+
+            if ( stopping || (claimed == frames.size()) ) {
+                break;
+            }
+
+            size_t frame = claimed;
+            claimed++;
+
+            //the slot was released by the consumer before the frame entered the window
+            guard.unlock();
+            decompressFrame(context, frame, slots[frame % window]);
+            guard.lock();
+
+            ready[frame % window] = true;
+            readyCond.notify_all();
+        }
+
+        ZSTD_freeDCtx(context);
+    }
+
+public:
+    ParallelZstdDecompressor(FILE* initFile, unsigned char* initMapping, size_t initMappingSize, const std::vector<std::pair<size_t, size_t> >& initFrames, unsigned threadCount):
+            Decompressor(initFile, nullptr, 0), mapping(initMapping), mappingSize(initMappingSize), frames(initFrames), claimed(0), delivered(0), deliveredPos(0), stopping(false) {
+        window = threadCount * COMPRESSED_TRACE_FRAMES_IN_FLIGHT_PER_THREAD;
+        slots.resize(window);
+        ready.assign(window, false);
+
+        for (unsigned i = 0; i < threadCount; i++) {
+            workers.push_back(std::thread(&ParallelZstdDecompressor::work, this));
+        }
+    }
+
+    virtual ~ParallelZstdDecompressor() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+
+        spaceCond.notify_all();
+
+        for (size_t i = 0; i < workers.size(); i++) {
+            workers[i].join();
+        }
+
+        munmap(mapping, mappingSize);
+    }
+
+    virtual size_t read(char* data, size_t size) {
+        size_t copied = 0;
+        std::unique_lock<std::mutex> guard(lock);
+
+        while ( (copied < size) && (delivered < frames.size()) ) {
+            size_t slot = delivered % window;
+            readyCond.wait(guard, [this, slot] { return ready[slot]; });
+            guard.unlock();
+
+            const std::vector<char>& output = slots[slot];
+            size_t count = std::min(size - copied, output.size() - deliveredPos);
+            memcpy(data + copied, output.data() + deliveredPos, count);
+            copied += count;
+            deliveredPos += count;
+
+            guard.lock();
+
+            if (deliveredPos == output.size()) {
+                ready[slot] = false;
+                delivered++;
+                deliveredPos = 0;
+                spaceCond.notify_all();
+            }
+        }
+
+        return copied;
+    }
+};
+
+/**
+ * Memory-map a zstd trace and find the boundaries of its frames
+ * @return The mapping, or nullptr if the file could not be mapped
+ */
+static unsigned char* mapZstdFrames(FILE* file, size_t& mappingSize, std::vector<std::pair<size_t, size_t> >& frames) {
+    struct stat info;
+
+    if ( (fstat(fileno(file), &info) != 0) || !S_ISREG(info.st_mode) || (info.st_size == 0) ) {
+        return nullptr;
+    }
+
+    mappingSize = info.st_size;
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    unsigned char* bytes = (unsigned char*) mapping;
+    size_t offset = 0;
+
+    while (offset < mappingSize) {
+        size_t frameSize = ZSTD_findFrameCompressedSize(bytes + offset, mappingSize - offset);
+
+        if (ZSTD_isError(frameSize)) {
+            fail("Zstd Trace Is Corrupted");
+        }
+
+        frames.push_back(std::make_pair(offset, frameSize));
+        offset += frameSize;
+    }
+
+    return bytes;
+}
+#endif
+
+static ssize_t readDecompressed(void* cookie, char* data, size_t size) {
+    return ((Decompressor*) cookie)->read(data, size);
+}
+
+static int closeDecompressed(void* cookie) {
+    delete (Decompressor*) cookie;
+    return 0;
+}
+
+FILE* openDecompressed(FILE* file, TraceCompression compression, const unsigned char* prefix, size_t prefixSize) {
+    Decompressor* decompressor = nullptr;
+
+    switch (compression) {
+        case TRACE_PLAIN:
+            decompressor = new PlainDecompressor(file, prefix, prefixSize);
+            break;
+        case TRACE_GZIP:
+#ifdef TRACE_HAVE_ZLIB
+            decompressor = new GzipDecompressor(file, prefix, prefixSize);
+            break;
+#else
+            fail("Gzip Traces Are Not Supported By This Build");
+#endif
+        case TRACE_XZ:
+#ifdef TRACE_HAVE_LZMA
+            decompressor = new XzDecompressor(file, prefix, prefixSize);
+            break;
+#else
+            fail("Xz Traces Are Not Supported By This Build");
+#endif
+        case TRACE_ZSTD:
+#ifdef TRACE_HAVE_ZSTD
+        {
+            unsigned threadCount = std::thread::hardware_concurrency();
+
+            if ( (prefixSize == 0) && (threadCount > 1) ) {
+                size_t mappingSize = 0;
+                std::vector<std::pair<size_t, size_t> > frames;
+                unsigned char* mapping = mapZstdFrames(file, mappingSize, frames);
+
+                if ( (mapping != nullptr) && (frames.size() > 1) ) {
+                    decompressor = new ParallelZstdDecompressor(file, mapping, mappingSize, frames, std::min<size_t>(threadCount, frames.size()));
+                    break;
+                }
+
+                if (mapping != nullptr) {
+                    munmap(mapping, mappingSize);
+                }
+            }
+
+            decompressor = new ZstdDecompressor(file, prefix, prefixSize);
+            break;
+        }
+#else
+            fail("Zstd Traces Are Not Supported By This Build");
+#endif
+    }
+
+    cookie_io_functions_t functions = {readDecompressed, nullptr, nullptr, closeDecompressed};
+    FILE* stream = fopencookie(decompressor, "r", functions);
+
+    if (stream == nullptr) {
+        fail("Decompressed Stream Cannot Be Opened");
+    }
+
+    return stream;
+}
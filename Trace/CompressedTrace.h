@@ -0,0 +1,51 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef CompressedTrace_h
+#define CompressedTrace_h
+
+#include <cstddef>
+#include <cstdio>
+
+#define COMPRESSED_TRACE_MAGIC_SIZE 6 //enough to tell every supported format apart
+#define COMPRESSED_TRACE_BUFFER_SIZE (1 << 20)
+#define COMPRESSED_TRACE_FRAMES_IN_FLIGHT_PER_THREAD 2
+
+enum TraceCompression {TRACE_PLAIN, TRACE_GZIP, TRACE_ZSTD, TRACE_XZ};
+
+/**
+ * @param first The first byte of a trace
+ * @return False if the trace is surely not compressed
+ */
+bool mayBeCompressed(int first);
+
+/**
+ * Recognize the compression of a trace by its magic number
+ * @param magic The first bytes of the trace
+ * @param size Number of bytes available in magic
+ * @return TRACE_PLAIN if no supported format matches
+ */
+TraceCompression detectCompression(const unsigned char* magic, size_t size);
+
+/**
+ * Wrap a (possibly compressed) stream into a stream of the decompressed bytes.
+ * Regular files compressed as several zstd frames (pzstd, seekable format, concatenated chunks) are decompressed
+ * in parallel, the frames being reassembled in order; every other input is decompressed while it is streamed
+ * @param file The underlying stream; closed along with the returned stream unless it is stdin
+ * @param compression Compression of the stream; TRACE_PLAIN only replays the prefix
+ * @param prefix Bytes already consumed from file, e.g. while recognizing the format; may be nullptr
+ * @param prefixSize Number of bytes in prefix
+ * @return The decompressed stream; fclose()ing it is caller's responsibility
+ */
+FILE* openDecompressed(FILE* file, TraceCompression compression, const unsigned char* prefix, size_t prefixSize);
+
+#endif /* CompressedTrace_h */
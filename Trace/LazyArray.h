@@ -0,0 +1,97 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef LazyArray_h
+#define LazyArray_h
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+#include <sys/mman.h>
+
+// #define LAZY_ARRAY_HUGE_PAGES //fewer TLB misses, but a touched element brings in 2 MiB instead of 4 KiB
+
+using namespace std;
+
+/**
+ * A fixed-size array of zero-initialized elements whose memory is reserved up front and backed page by page on
+ * first touch, so that the memory taken by a cache model follows the footprint of the trace rather than the size
+ * of the cache. Only for types whose initial state is all bytes zero.
+ */
+template<class T>
+class LazyArray {
+    static_assert(is_trivially_copyable<T>::value, "elements must start as zero bytes");
+    
+private:
+    T* items;
+    size_t bytes;
+    
+public:
+    /**
+     * Constructor; reserves the address space only
+     */
+    explicit LazyArray(size_t count): bytes(count * sizeof(T)) {
+        void* storage = mmap(nullptr, (bytes != 0) ? bytes : 1, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        
+        if (storage == MAP_FAILED) {
+            cout << "Cache Cannot Be Allocated\n";
+            exit(EXIT_FAILURE);
+        }
+        
+#ifdef LAZY_ARRAY_HUGE_PAGES
+        madvise(storage, bytes, MADV_HUGEPAGE);
+#endif
+        items = (T*) storage;
+    }
+    
+    LazyArray(const LazyArray&) = delete;
+    
+    /**
+     * Move constructor; the pages are handed over, not copied
+     */
+    LazyArray(LazyArray&& src): items(src.items), bytes(src.bytes) {
+        src.items = nullptr;
+    }
+    
+    /**
+     * Destructor; returns the pages
+     */
+    ~LazyArray() {
+        
+        if (items != nullptr) {
+            munmap(items, (bytes != 0) ? bytes : 1);
+        }
+        
+    }
+    
+    T& operator[](size_t index) {
+        return items[index];
+    }
+    
+    const T& operator[](size_t index) const {
+        return items[index];
+    }
+    
+    /**
+     * @return The first element; page aligned
+     */
+    T* data() {
+        return items;
+    }
+    
+    const T* data() const {
+        return items;
+    }
+};
+
+#endif /* LazyArray_h */
@@ -0,0 +1,121 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "RecordStream.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
+
+RecordStreamWriter::RecordStreamWriter(int initFd, uint64_t leadingIgnored): fd(initFd), broken(false) {
+    uint32_t version = RECORD_STREAM_VERSION;
+    uint32_t recordSize = sizeof(TraceRecord);
+    writeAll(RECORD_STREAM_MAGIC, RECORD_STREAM_MAGIC_SIZE);
+    writeAll(&version, sizeof(version));
+    writeAll(&recordSize, sizeof(recordSize));
+    writeAll(&leadingIgnored, sizeof(leadingIgnored));
+}
+
+bool RecordStreamWriter::writeAll(const void* data, size_t size) {
+    const char* pos = (const char*) data;
+
+    while ( !broken && (size > 0) ) {
+        ssize_t written = ::write(fd, pos, size);
+
+        if (written < 0) {
+            broken = (errno != EINTR);
+            continue;
+        }
+
+        pos += written;
+        size -= written;
+    }
+
+    return !broken;
+}
+
+bool RecordStreamWriter::write(const TraceRecord* records, uint32_t count) {
+    return writeAll(&count, sizeof(count)) && writeAll(records, count * sizeof(TraceRecord));
+}
+
+void RecordStreamWriter::close(uint64_t trailingIgnored) {
+    uint32_t end = 0;
+    writeAll(&end, sizeof(end));
+    writeAll(&trailingIgnored, sizeof(trailingIgnored));
+    ::close(fd);
+}
+
+RecordStreamReader::RecordStreamReader(FILE* initFile): file(initFile), count(0), index(0), ended(false) {
+    char magic[RECORD_STREAM_MAGIC_SIZE];
+    uint32_t version, recordSize;
+
+    if ( (fread(magic, 1, RECORD_STREAM_MAGIC_SIZE, file) != RECORD_STREAM_MAGIC_SIZE) || (memcmp(magic, RECORD_STREAM_MAGIC, RECORD_STREAM_MAGIC_SIZE) != 0)
+            || (fread(&version, sizeof(version), 1, file) != 1) || (fread(&recordSize, sizeof(recordSize), 1, file) != 1)
+            || (fread(&leadingIgnored, sizeof(leadingIgnored), 1, file) != 1) ) {
+        std::cout << "Record Stream Is Corrupted\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if ( (version != RECORD_STREAM_VERSION) || (recordSize != sizeof(TraceRecord)) ) {
+        std::cout << "Record Stream Was Written By Another Build\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+RecordStreamReader::~RecordStreamReader() {
+
+    if (file != stdin) {
+        fclose(file);
+    }
+
+}
+
+bool RecordStreamReader::next(TraceRecord& record) {
+
+    while (index == count) {
+
+        if (ended) {
+            return false;
+        }
+
+        if (fread(&count, sizeof(count), 1, file) != 1) {
+            std::cout << "Record Stream Is Truncated\n";
+            exit(EXIT_FAILURE);
+        }
+
+        index = 0;
+
+        if (count == 0) {
+            ended = true;
+
+            if (fread(&trailingIgnored, sizeof(trailingIgnored), 1, file) != 1) {
+                std::cout << "Record Stream Is Truncated\n";
+                exit(EXIT_FAILURE);
+            }
+
+            continue;
+        }
+
+        frame.resize(count);
+
+        if (fread(frame.data(), sizeof(TraceRecord), count, file) != count) {
+            std::cout << "Record Stream Is Truncated\n";
+            exit(EXIT_FAILURE);
+        }
+
+    }
+
+    record = frame[index++];
+    return true;
+}
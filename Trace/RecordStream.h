@@ -0,0 +1,83 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef RecordStream_h
+#define RecordStream_h
+
+#include "TraceReader.h"
+#include <cstdio>
+#include <vector>
+
+/*
+ * Record stream layout: the records of a trace already parsed, as they are in memory, for the pipes between the
+ * processes of one build (see the sweep of the driver); it is never stored
+ * header: magic[8], version (u32), record size (u32), leading ignored (u64)
+ * frames: record count (u32), records; a frame of zero records ends the stream and is followed by trailing ignored (u64)
+ * integers are in host byte order
+ */
+#define RECORD_STREAM_MAGIC "\x8aICDREC\n" //the first byte tells it apart from the other formats (see openTrace())
+#define RECORD_STREAM_MAGIC_SIZE 8
+#define RECORD_STREAM_VERSION 1
+
+class RecordStreamWriter {
+private:
+    int fd;
+    bool broken; //the reader has gone away
+
+    /**
+     * @return False if the reader has gone away
+     */
+    bool writeAll(const void* data, size_t size);
+
+public:
+    /**
+     * Constructor; writes the header
+     * @param initFd Descriptor the stream is written to, usually a pipe; closed by close()
+     */
+    RecordStreamWriter(int initFd, uint64_t leadingIgnored);
+
+    /**
+     * Append a frame
+     * @return False if the reader has gone away, as it does when it needs no more of the trace
+     */
+    bool write(const TraceRecord* records, uint32_t count);
+
+    /**
+     * Write the end of the stream, then close the descriptor
+     */
+    void close(uint64_t trailingIgnored);
+};
+
+class RecordStreamReader: public TraceReader {
+private:
+    FILE* file;
+    std::vector<TraceRecord> frame;
+    uint32_t count;
+    uint32_t index;
+    bool ended;
+
+public:
+    /**
+     * Constructor; reads and validates the header
+     * @param initFile Stream positioned at its header; closed by the destructor unless it is stdin
+     */
+    RecordStreamReader(FILE* initFile);
+
+    /**
+     * Destructor; closes the file
+     */
+    virtual ~RecordStreamReader();
+
+    virtual bool next(TraceRecord& record);
+};
+
+#endif /* RecordStream_h */
@@ -0,0 +1,60 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef RunConfig_h
+#define RunConfig_h
+
+#include <string>
+
+/**
+ * Configuration of one simulation; filled by the driver from the command line or a config file,
+ * or by the per-model executables from their compile-time defaults
+ */
+struct RunConfig {
+    std::string model; //name in the policy registry of the driver
+    std::string tracePath; //empty reads stdin
+    bool traceOnStdin; //sweep points only; the records are streamed on stdin, and tracePath only names the trace in the report
+    int cacheKiB;
+    int maxCacheKiB; //sweeps only; every power-of-two multiple of cacheKiB up to this one is simulated
+    int associativity;
+    int blockBytes;
+    int cuckooWayCount; //ICD only
+    int threshold; //ICD only
+    int searchDepth; //ICD only; 0 inserts into the cuckoo ways by the round-robin walk, otherwise by a breadth-first search this many displacements deep
+    bool coalesce; //LRU and ICD only
+    bool countExact2WBs; //LRU and ICD only
+    std::string timeTracePath; //a time trace (an energy trace for HAP) is written there if not empty
+    double clkStep; //time trace only
+    int threads; //LRU only; the sets are shared among this many threads
+    std::string checkpointPath; //the state of the run is saved there at the end of the trace if not empty
+    long long checkpointEvery; //and every this many queries if not 0
+    std::string restorePath; //the run resumes from this snapshot if not empty
+    int sampleSets; //LRU and ICD only; 1 in this many sets is simulated and the totals are estimated from them
+    long long sampleLength; //queries measured in each window of time sampling (see TimeSampler); 0 measures them all
+    long long samplePeriod; //queries from the start of one window to the start of the next
+    double sampleError; //time sampling stops once its margins are below this fraction of the estimates; 0 reads the whole trace
+    std::string telemetryPath; //ICD only; the displacement telemetry of the cuckoo section is written there if not empty
+    long long telemetryEvery; //queries from one sample of the telemetry to the next
+    
+    RunConfig(): traceOnStdin(false), cacheKiB(512), maxCacheKiB(0), associativity(0), blockBytes(64), cuckooWayCount(0), threshold(0), searchDepth(0), coalesce(false), countExact2WBs(false), clkStep(0), threads(1), checkpointEvery(0), sampleSets(1), sampleLength(0), samplePeriod(0), sampleError(0), telemetryEvery(0) {
+        
+    }
+    
+    /**
+     * @return The path to open the trace from; empty, that is stdin, if the records are streamed there
+     */
+    std::string traceSource() const {
+        return traceOnStdin ? "" : tracePath;
+    }
+};
+
+#endif /* RunConfig_h */
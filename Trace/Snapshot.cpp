@@ -0,0 +1,232 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "Snapshot.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+SnapshotWriter::SnapshotWriter(const std::string& initPath, const RunConfig& config, uint64_t queryOffset): path(initPath), tempPath(initPath + ".tmp") {
+    file = fopen(tempPath.c_str(), "wb");
+
+    if (file == nullptr) {
+        std::cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+
+    putRaw(SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE);
+    put32(SNAPSHOT_VERSION);
+    put32((uint32_t) config.model.size());
+    putRaw(config.model.data(), config.model.size());
+    put32((uint32_t) config.cacheKiB);
+    put32((uint32_t) config.associativity);
+    put32((uint32_t) config.blockBytes);
+    put32((uint32_t) config.cuckooWayCount);
+    put32((uint32_t) config.threshold);
+    put32((uint32_t) config.searchDepth);
+    put64(queryOffset);
+}
+
+SnapshotWriter::~SnapshotWriter() {
+
+    if (file != nullptr) {
+        close();
+    }
+
+}
+
+void SnapshotWriter::put8(uint8_t value) {
+    putc(value, file);
+}
+
+void SnapshotWriter::put32(uint32_t value) {
+    uint8_t raw[4];
+
+    for (int i = 0; i < 4; i++) {
+        raw[i] = (uint8_t) (value >> (8 * i));
+    }
+
+    fwrite(raw, 1, 4, file);
+}
+
+void SnapshotWriter::put64(uint64_t value) {
+    uint8_t raw[8];
+
+    for (int i = 0; i < 8; i++) {
+        raw[i] = (uint8_t) (value >> (8 * i));
+    }
+
+    fwrite(raw, 1, 8, file);
+}
+
+void SnapshotWriter::putRaw(const void* data, size_t size) {
+    fwrite(data, 1, size, file);
+}
+
+void SnapshotWriter::putValue(const BlockValue& value) {
+    put8(value.validWords);
+
+    for (int i = 0; i < BLOCK_VALUE_WORDS; i++) {
+
+        if (value.hasWord(i)) {
+            put64(value.getWord(i));
+        }
+
+    }
+
+}
+
+void SnapshotWriter::close() {
+    put32(SNAPSHOT_END);
+
+    if ( (fclose(file) != 0) || (rename(tempPath.c_str(), path.c_str()) != 0) ) {
+        std::cout << "Snapshot Cannot Be Written\n";
+        exit(EXIT_FAILURE);
+    }
+
+    file = nullptr;
+}
+
+SnapshotReader::SnapshotReader(const std::string& path, const RunConfig& config) {
+    file = fopen(path.c_str(), "rb");
+
+    if (file == nullptr) {
+        std::cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+
+    char magic[SNAPSHOT_MAGIC_SIZE];
+    getRaw(magic, SNAPSHOT_MAGIC_SIZE);
+
+    if (memcmp(magic, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_SIZE) != 0) {
+        std::cout << "Bad Snapshot Header\n";
+        exit(EXIT_FAILURE);
+    }
+
+    uint32_t version = get32();
+
+    if (version != SNAPSHOT_VERSION) {
+        std::cout << "Unsupported Snapshot Version " << version << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::string model(get32(), '\0');
+    getRaw(&model[0], model.size());
+    bool match = (model == config.model);
+    match = (get32() == (uint32_t) config.cacheKiB) && match;
+    match = (get32() == (uint32_t) config.associativity) && match;
+    match = (get32() == (uint32_t) config.blockBytes) && match;
+    match = (get32() == (uint32_t) config.cuckooWayCount) && match;
+    match = (get32() == (uint32_t) config.threshold) && match;
+    match = (get32() == (uint32_t) config.searchDepth) && match;
+
+    if (!match) {
+        std::cout << "Snapshot Does Not Match The Configuration\n";
+        exit(EXIT_FAILURE);
+    }
+
+    queryOffset = get64();
+}
+
+SnapshotReader::~SnapshotReader() {
+
+    if (file != nullptr) {
+        fclose(file);
+    }
+
+}
+
+uint8_t SnapshotReader::get8() {
+    uint8_t value;
+    getRaw(&value, 1);
+    return value;
+}
+
+uint32_t SnapshotReader::get32() {
+    uint8_t raw[4];
+    uint32_t value = 0;
+    getRaw(raw, 4);
+
+    for (int i = 0; i < 4; i++) {
+        value |= ((uint32_t) raw[i]) << (8 * i);
+    }
+
+    return value;
+}
+
+uint64_t SnapshotReader::get64() {
+    uint8_t raw[8];
+    uint64_t value = 0;
+    getRaw(raw, 8);
+
+    for (int i = 0; i < 8; i++) {
+        value |= ((uint64_t) raw[i]) << (8 * i);
+    }
+
+    return value;
+}
+
+void SnapshotReader::getRaw(void* data, size_t size) {
+
+    if (fread(data, 1, size, file) != size) {
+        std::cout << "Snapshot Is Truncated\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+void SnapshotReader::getValue(BlockValue& value) {
+    uint8_t validWords = get8();
+    value = BlockValue();
+
+    for (int i = 0; i < BLOCK_VALUE_WORDS; i++) {
+
+        if ((validWords >> i) & 1) {
+            value.setWord(i, get64());
+        }
+
+    }
+
+}
+
+void SnapshotReader::close() {
+
+    if (get32() != SNAPSHOT_END) {
+        std::cout << "Snapshot Is Corrupted\n";
+        exit(EXIT_FAILURE);
+    }
+
+    fclose(file);
+    file = nullptr;
+}
+
+uint64_t SnapshotReader::getQueryOffset() const {
+    return queryOffset;
+}
+
+void skipQueries(TraceReader* trace, uint64_t count) {
+    TraceRecord record;
+
+    while (count != 0) {
+
+        if (!trace->next(record)) {
+            std::cout << "Trace Is Shorter Than The Snapshot\n";
+            exit(EXIT_FAILURE);
+        }
+
+        if (record.type != TRACE_UPGRADE) {
+            count--;
+        }
+
+    }
+
+}
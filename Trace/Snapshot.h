@@ -0,0 +1,113 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef Snapshot_h
+#define Snapshot_h
+
+#include "RunConfig.h"
+#include "TraceReader.h"
+#include <cstdio>
+#include <string>
+
+/*
+ * Snapshot layout (all integers little-endian)
+ * header: magic[8], version (u32), model name (u32 length and bytes), cache size, associativity, block size,
+ * cuckoo way count, threshold, search depth (u32 each), query offset (u64)
+ * body: the state of the run, as written by the model; the models write with the put methods and read back in the same order
+ * footer: SNAPSHOT_END (u32)
+ *
+ * a snapshot is only meant to be read by the build that wrote it; layouts of floating point numbers are the host's
+ */
+#define SNAPSHOT_MAGIC "\x89ICDSNP\n"
+#define SNAPSHOT_MAGIC_SIZE 8
+#define SNAPSHOT_VERSION 4
+#define SNAPSHOT_END 0x444e4521
+
+class SnapshotWriter {
+private:
+    FILE* file;
+    std::string path;
+    std::string tempPath;
+
+public:
+    /**
+     * Constructor; writes the header
+     * @param initPath Path of the snapshot; it is written next to it and renamed into place by close(), so that
+     * a crash never leaves a partial snapshot behind
+     * @param queryOffset Number of queries (records other than upgrades) simulated before the snapshot
+     */
+    SnapshotWriter(const std::string& initPath, const RunConfig& config, uint64_t queryOffset);
+
+    /**
+     * Destructor; closes the file in case
+     */
+    ~SnapshotWriter();
+
+    void put8(uint8_t value);
+    void put32(uint32_t value);
+    void put64(uint64_t value);
+
+    /**
+     * Write the bytes of an object as they are in memory
+     */
+    void putRaw(const void* data, size_t size);
+
+    /**
+     * Write the valid words of a value
+     */
+    void putValue(const BlockValue& value);
+
+    /**
+     * Write the footer, then move the snapshot into place
+     */
+    void close();
+};
+
+class SnapshotReader {
+private:
+    FILE* file;
+    uint64_t queryOffset;
+
+public:
+    /**
+     * Constructor; reads the header and checks it against the configuration
+     */
+    SnapshotReader(const std::string& path, const RunConfig& config);
+
+    /**
+     * Destructor; closes the file in case
+     */
+    ~SnapshotReader();
+
+    uint8_t get8();
+    uint32_t get32();
+    uint64_t get64();
+    void getRaw(void* data, size_t size);
+    void getValue(BlockValue& value);
+
+    /**
+     * Check the footer and close the file
+     */
+    void close();
+
+    /**
+     * @return Number of queries simulated before the snapshot
+     */
+    uint64_t getQueryOffset() const;
+};
+
+/**
+ * Skip the queries a restored snapshot has already simulated; upgrades are not queries
+ */
+void skipQueries(TraceReader* trace, uint64_t count);
+
+#endif /* Snapshot_h */
@@ -0,0 +1,255 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+#include "TextTrace.h"
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+TextTraceReader::TextTraceReader(FILE* initStream): stream(initStream), mapping(nullptr), mappingSize(0), buffer(TEXT_TRACE_BUFFER_SIZE), lineCount(0) {
+    pos = end = buffer.data();
+    skipLeading();
+}
+
+TextTraceReader::TextTraceReader(const std::string& path): stream(nullptr), mapping(nullptr), mappingSize(0), lineCount(0) {
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat info;
+
+    if ( (fd < 0) || (fstat(fd, &info) != 0) ) {
+        std::cout << "Specified File Cannot Be Opened\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if ( S_ISREG(info.st_mode) && (info.st_size > 0) ) {
+        void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (mapped != MAP_FAILED) {
+            madvise(mapped, info.st_size, MADV_SEQUENTIAL);
+            mapping = (char*) mapped;
+            mappingSize = info.st_size;
+        }
+
+    }
+
+    if (mapping != nullptr) {
+        close(fd); //the mapping stays valid
+        pos = mapping;
+        end = mapping + mappingSize;
+    } else {
+        //the trace cannot be mapped (e.g. it is empty); read it like a stream
+        stream = fdopen(fd, "rb");
+        buffer.resize(TEXT_TRACE_BUFFER_SIZE);
+        pos = end = buffer.data();
+    }
+
+    skipLeading();
+}
+
+TextTraceReader::~TextTraceReader() {
+
+    if (mapping != nullptr) {
+        munmap(mapping, mappingSize);
+    }
+
+    if ( (stream != nullptr) && (stream != stdin) ) {
+        fclose(stream);
+    }
+
+}
+
+bool TextTraceReader::refill() {
+
+    if ( (stream == nullptr) || feof(stream) ) {
+        return false;
+    }
+
+    size_t tail = end - pos;
+
+    if (tail == buffer.size()) {
+        //a single line fills the whole buffer
+        size_t offset = pos - buffer.data();
+        buffer.resize(buffer.size() * 2);
+        pos = buffer.data() + offset;
+    } else {
+        memmove(buffer.data(), pos, tail);
+        pos = buffer.data();
+    }
+
+    size_t count = fread(buffer.data() + tail, 1, buffer.size() - tail, stream);
+    end = pos + tail + count;
+    return count != 0;
+}
+
+bool TextTraceReader::nextLine(const char*& line, const char*& lineEnd) {
+    size_t scanned = 0;
+    const char* newline;
+
+    while ( (newline = (const char*) memchr(pos + scanned, '\n', end - pos - scanned)) == nullptr ) {
+        scanned = end - pos;
+
+        if (!refill()) {
+
+            if (pos == end) {
+                return false;
+            }
+
+            //last line without a newline character
+            line = pos;
+            lineEnd = end;
+            pos = end;
+            lineCount++;
+            return true;
+        }
+
+    }
+
+    line = pos;
+    lineEnd = newline;
+    pos = newline + 1;
+    lineCount++;
+    return true;
+}
+
+static inline bool isDigit(char c) {
+    return (unsigned char) (c - '0') < 10;
+}
+
+static inline const char* skipSpace(const char* pos, const char* lineEnd) {
+
+    while ( (pos != lineEnd) && ( (*pos == ' ') || (*pos == '\t') ) ) {
+        pos++;
+    }
+
+    return pos;
+}
+
+static inline const char* skipToken(const char* pos, const char* lineEnd) {
+
+    while ( (pos != lineEnd) && (*pos != ' ') && (*pos != '\t') ) {
+        pos++;
+    }
+
+    return pos;
+}
+
+static inline const char* scanNumber(const char* pos, const char* lineEnd, uint64_t& number) {
+    number = 0;
+
+    while ( (pos != lineEnd) && isDigit(*pos) ) {
+        number = number * 10 + (*pos - '0');
+        pos++;
+    }
+
+    return pos;
+}
+
+void TextTraceReader::skipLeading() {
+    const char* line;
+    const char* lineEnd;
+
+    while (nextLine(line, lineEnd)) {
+        const char* first = skipSpace(line, lineEnd);
+
+        if ( (first != lineEnd) && isDigit(*first) ) {
+            pos = line; //first record; leave it for next()
+            lineCount--;
+            return;
+        }
+
+        leadingIgnored++;
+    }
+
+}
+
+bool TextTraceReader::next(TraceRecord& record) {
+    const char* line;
+    const char* lineEnd;
+    uint64_t skipped = 0;
+
+    while (nextLine(line, lineEnd)) {
+
+        if (parseTraceLine(line, lineEnd, record, lineCount)) {
+            return true;
+        }
+
+        skipped++;
+    }
+
+    trailingIgnored = skipped; //only the lines after the last record are left
+    return false;
+}
+
+bool parseTraceLine(const char* line, const char* lineEnd, TraceRecord& record, uint64_t lineNumber) {
+    const char* pos = skipSpace(line, lineEnd);
+
+    if ( (pos == lineEnd) || !isDigit(*pos) ) {
+        return false;
+    }
+
+    pos = scanNumber(pos, lineEnd, record.pc);
+    pos = scanNumber(skipSpace(pos, lineEnd), lineEnd, record.addr);
+    const char* first = skipSpace(pos, lineEnd);
+    const char* second = skipSpace(skipToken(first, lineEnd), lineEnd);
+    const char* value = skipToken(second, lineEnd);
+
+    if (value - second < 2) {
+        assert(false && "bad trace");
+        return false;
+    }
+
+    switch(first[0]) {
+        case 'F':
+            record.type = TRACE_FETCH;
+            break;
+
+        case 'R':
+            record.type = TRACE_READ;
+            break;
+
+        case 'W':
+            record.type = TRACE_WRITE;
+            break;
+
+        case 'E':
+
+            if (second[1] == 'w') {
+                record.type = TRACE_EVICT_WRITABLE;
+            } else if (second[1] == 'c') {
+                record.type = TRACE_EVICT_CLEAN;
+            } else if (second[1] == 'd') {
+                record.type = TRACE_EVICT_DIRTY;
+            } else {
+                assert(false && "bad trace");
+            }
+
+            break;
+
+        case 'U':
+            record.type = TRACE_UPGRADE;
+            break;
+
+        default:
+            assert(false && "bad trace");
+            break;
+    }
+
+    if (!parseBlockValue(value, lineEnd, record.value)) {
+        std::cout << "Bad Trace Value On Line " << lineNumber << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return true;
+}
@@ -0,0 +1,81 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+#ifndef TextTrace_h
+#define TextTrace_h
+
+#include "TraceReader.h"
+#include <cstdio>
+#include <vector>
+
+#define TEXT_TRACE_BUFFER_SIZE (1 << 20)
+
+/**
+ * Reads the text trace; each line is formatted as "pc addr Type (qual) value"
+ * Lines that do not begin with a number are ignored
+ * Regular files are memory-mapped and parsed in place; pipes and stdin are read through a buffer
+ */
+class TextTraceReader: public TraceReader {
+private:
+    FILE* stream; //nullptr if the trace is memory-mapped
+    char* mapping;
+    size_t mappingSize;
+    std::vector<char> buffer;
+    const char* pos;
+    const char* end;
+    uint64_t lineCount; //lines fetched so far, so the number of the current one
+
+    /**
+     * Move the unparsed tail to the front of the buffer and read more of the stream
+     * @return False if nothing more could be read
+     */
+    bool refill();
+
+    /**
+     * Fetch the next line, without its newline character
+     * @return False if the trace is exhausted
+     */
+    bool nextLine(const char*& line, const char*& lineEnd);
+
+    /**
+     * Skip the lines before the first record
+     */
+    void skipLeading();
+
+public:
+    /**
+     * Constructor
+     * @param initStream Stream of the trace (stdin or a pipe); closed by the destructor unless it is stdin
+     */
+    TextTraceReader(FILE* initStream);
+
+    /**
+     * Constructor; memory-maps the trace
+     * @param path Path of the trace, a regular file
+     */
+    TextTraceReader(const std::string& path);
+
+    /**
+     * Destructor; unmaps or closes the trace
+     */
+    virtual ~TextTraceReader();
+
+    virtual bool next(TraceRecord& record);
+};
+
+/**
+ * Parse a single line of the text trace in place; a record whose value cannot be parsed ends the run
+ * @param lineNumber Number of the line in the trace, for the error message
+ * @return False if the line does not begin with a number and should be ignored
+ */
+bool parseTraceLine(const char* line, const char* lineEnd, TraceRecord& record, uint64_t lineNumber);
+
+#endif /* TextTrace_h */
@@ -0,0 +1,90 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "TimeSampler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+TimeSampler::TimeSampler(const RunConfig& config): length(config.sampleLength), period(config.samplePeriod), targetError(config.sampleError), position(0), startWriteBacks(0), startReadHits(0), startReads(0), windowCount(0), writeBacks(0), writeBackSquares(0), readHits(0), readHitSquares(0), reads(0), readSquares(0), readProducts(0), converged(false) {
+
+    if ( (config.sampleLength <= 0) || (config.samplePeriod < config.sampleLength) ) {
+        std::cout << "Sample Period Must Not Be Shorter Than Sample Length\n";
+        exit(EXIT_FAILURE);
+    }
+
+    if (config.sampleError < 0) {
+        std::cout << "Sample Error Must Not Be Negative\n";
+        exit(EXIT_FAILURE);
+    }
+
+}
+
+void TimeSampler::closeWindow(uint64_t modelWriteBacks, uint64_t modelReadHits, uint64_t modelReads) {
+    long double windowWriteBacks = modelWriteBacks - startWriteBacks;
+    long double windowReadHits = modelReadHits - startReadHits;
+    long double windowReads = modelReads - startReads;
+    windowCount++;
+    writeBacks += windowWriteBacks;
+    writeBackSquares += windowWriteBacks * windowWriteBacks;
+    readHits += windowReadHits;
+    readHitSquares += windowReadHits * windowReadHits;
+    reads += windowReads;
+    readSquares += windowReads * windowReads;
+    readProducts += windowReadHits * windowReads;
+
+    if ( (targetError > 0) && (windowCount >= TIME_SAMPLER_MIN_WINDOWS) ) {
+        converged = (getWriteBackMargin() <= targetError * getWriteBackRate()) && (getReadHitRatioMargin() <= targetError * getReadHitRatio());
+    }
+
+}
+
+long double TimeSampler::getWriteBackRate() const {
+    return (windowCount == 0) ? 0 : writeBacks / windowCount / length;
+}
+
+long double TimeSampler::getWriteBackMargin() const {
+
+    if (windowCount < 2) {
+        return 0;
+    }
+
+    long double mean = writeBacks / windowCount;
+    long double variance = (writeBackSquares - windowCount * mean * mean) / (windowCount - 1);
+    return TIME_SAMPLER_Z * sqrt(std::max(variance, (long double) 0) / windowCount) / length;
+}
+
+long double TimeSampler::getReadHitRatio() const {
+    return (reads == 0) ? 0 : readHits / reads;
+}
+
+long double TimeSampler::getReadHitRatioMargin() const {
+
+    if ( (windowCount < 2) || (reads == 0) ) {
+        return 0;
+    }
+
+    //sum of the squared residuals of the windows, readHits - ratio * reads, expanded
+    long double ratio = readHits / reads;
+    long double squares = readHitSquares - 2 * ratio * readProducts + ratio * ratio * readSquares;
+    long double meanReads = reads / windowCount;
+    return TIME_SAMPLER_Z * sqrt(std::max(squares, (long double) 0) / (windowCount - 1) / windowCount) / meanReads;
+}
+
+void TimeSampler::print(std::ostream& out) const {
+    out << "TIME SAMPLING: \t\t" << windowCount << " WINDOWS OF " << length << " IN " << period << " QUERIES";
+    out << (converged ? " (STOPPED AT THE TARGET ERROR)" : "") << "\n";
+    out << "WRITE BACKS PER 1000 QUERIES: \t" << std::fixed << std::setprecision(5) << 1000 * getWriteBackRate() << " +- " << 1000 * getWriteBackMargin() << "\n";
+    out << "READ HIT RATIO: \t\t" << std::fixed << std::setprecision(5) << getReadHitRatio() << " +- " << getReadHitRatioMargin() << "\n";
+}
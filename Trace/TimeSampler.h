@@ -0,0 +1,101 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef TimeSampler_h
+#define TimeSampler_h
+
+#include "RunConfig.h"
+#include <cstdint>
+#include <ostream>
+
+#define TIME_SAMPLER_MIN_WINDOWS 30 //the margins are not trusted, and the run not stopped, before this many windows
+#define TIME_SAMPLER_Z 1.96 //two-sided 95% quantile of the normal distribution
+
+/**
+ * Time sampling in the manner of SMARTS: out of every config.samplePeriod queries, the first config.sampleLength are
+ * simulated in detail and measured, and the others only warm the model up (functional warming), so that every window
+ * starts from the state a full simulation would have. The windows give the writeback rate and the read hit ratio
+ * with their 95% margins, and the run may stop as soon as both margins are below config.sampleError of the estimates
+ */
+class TimeSampler {
+private:
+    uint64_t length;
+    uint64_t period;
+    double targetError; //0 never stops the run early
+    uint64_t position; //queries since the start of the current period
+    uint64_t startWriteBacks, startReadHits, startReads; //statistics of the model at the start of the current window
+    uint64_t windowCount;
+    long double writeBacks, writeBackSquares; //sums over the windows
+    long double readHits, readHitSquares, reads, readSquares, readProducts;
+    bool converged;
+
+public:
+    /**
+     * Constructor; the first query starts a window
+     */
+    TimeSampler(const RunConfig& config);
+
+    /**
+     * @return True if the next query is measured, false if it only warms the model up
+     */
+    bool detailed() const {
+        return position < length;
+    }
+
+    /**
+     * Count a query; to be called after every query, warming ones included, with the statistics of the model so far
+     */
+    void advance(uint64_t modelWriteBacks, uint64_t modelReadHits, uint64_t modelReads) {
+        position++;
+
+        if (position == length) {
+            closeWindow(modelWriteBacks, modelReadHits, modelReads);
+        }
+
+        if (position == period) {
+            position = 0;
+            startWriteBacks = modelWriteBacks;
+            startReadHits = modelReadHits;
+            startReads = modelReads;
+        }
+
+    }
+
+    /**
+     * @return True once the margins are below the target error; the rest of the trace need not be simulated
+     */
+    bool done() const {
+        return converged;
+    }
+
+    /**
+     * @return Writebacks per query, and its 95% margin
+     */
+    long double getWriteBackRate() const;
+    long double getWriteBackMargin() const;
+
+    /**
+     * @return Read hit ratio, and its 95% margin; the ratio of the sums over the windows, whose variance is that of the ratio estimator
+     */
+    long double getReadHitRatio() const;
+    long double getReadHitRatioMargin() const;
+
+    /**
+     * Print the estimates in the manner of the reports of the simulators
+     */
+    void print(std::ostream& out) const;
+
+private:
+    void closeWindow(uint64_t modelWriteBacks, uint64_t modelReadHits, uint64_t modelReads);
+};
+
+#endif /* TimeSampler_h */
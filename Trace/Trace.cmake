@@ -0,0 +1,52 @@
+# Trace readers shared by the simulators; include() this file, add ${TRACE_SOURCE_FILES} to the target and link it with ${TRACE_LIBRARIES}
+
+set(TRACE_SOURCE_FILES
+        ${CMAKE_CURRENT_LIST_DIR}/BlockValue.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/BlockValue.h
+        ${CMAKE_CURRENT_LIST_DIR}/BinaryTrace.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/BinaryTrace.h
+        ${CMAKE_CURRENT_LIST_DIR}/CompressedTrace.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/CompressedTrace.h
+        ${CMAKE_CURRENT_LIST_DIR}/LazyArray.h
+        ${CMAKE_CURRENT_LIST_DIR}/RecordStream.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/RecordStream.h
+        ${CMAKE_CURRENT_LIST_DIR}/RunConfig.h
+        ${CMAKE_CURRENT_LIST_DIR}/Snapshot.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/Snapshot.h
+        ${CMAKE_CURRENT_LIST_DIR}/TextTrace.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/TextTrace.h
+        ${CMAKE_CURRENT_LIST_DIR}/TimeSampler.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/TimeSampler.h
+        ${CMAKE_CURRENT_LIST_DIR}/TracePipeline.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/TracePipeline.h
+        ${CMAKE_CURRENT_LIST_DIR}/TraceReader.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/TraceReader.h
+        ${CMAKE_CURRENT_LIST_DIR}/TraceRecord.h)
+
+find_package(Threads REQUIRED)
+set(TRACE_LIBRARIES Threads::Threads)
+
+# compressed traces; every format is optional and reported as unsupported at run time if its library is missing
+find_package(ZLIB)
+if(ZLIB_FOUND)
+    add_definitions(-DTRACE_HAVE_ZLIB)
+    include_directories(${ZLIB_INCLUDE_DIRS})
+    list(APPEND TRACE_LIBRARIES ${ZLIB_LIBRARIES})
+endif()
+
+find_package(LibLZMA)
+if(LIBLZMA_FOUND)
+    add_definitions(-DTRACE_HAVE_LZMA)
+    include_directories(${LIBLZMA_INCLUDE_DIRS})
+    list(APPEND TRACE_LIBRARIES ${LIBLZMA_LIBRARIES})
+endif()
+
+find_path(ZSTD_INCLUDE_DIR zstd.h)
+find_library(ZSTD_LIBRARY zstd)
+if(ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+    add_definitions(-DTRACE_HAVE_ZSTD)
+    include_directories(${ZSTD_INCLUDE_DIR})
+    list(APPEND TRACE_LIBRARIES ${ZSTD_LIBRARY})
+endif()
+
+include_directories(${CMAKE_CURRENT_LIST_DIR})
@@ -0,0 +1,96 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include "TracePipeline.h"
+
+PipelinedTraceReader::PipelinedTraceReader(TraceReader* initSource): source(initSource), produced(0), consumed(0), stopping(false), current(nullptr), index(0) {
+    leadingIgnored = source->getLeadingIgnored();
+
+    for (int i = 0; i < TRACE_PIPELINE_DEPTH; i++) {
+        ring[i].records.resize(TRACE_PIPELINE_BATCH_RECORDS);
+        ring[i].count = 0;
+        ring[i].last = false;
+    }
+
+    producer = std::thread(&PipelinedTraceReader::produce, this);
+}
+
+PipelinedTraceReader::~PipelinedTraceReader() {
+    stopping.store(true, std::memory_order_relaxed);
+    producer.join();
+    delete source;
+}
+
+bool PipelinedTraceReader::fill(TraceBatch& batch) {
+    bool more = true;
+
+    batch.count = 0;
+
+    while ( (batch.count < TRACE_PIPELINE_BATCH_RECORDS) && (more = source->next(batch.records[batch.count])) ) {
+        batch.count++;
+    }
+
+    batch.last = !more;
+    return more;
+}
+
+void PipelinedTraceReader::produce() {
+    uint64_t batchCount = 0;
+    bool more = true;
+
+    while (more) {
+        //wait for a free slot
+        while ( (batchCount - consumed.load(std::memory_order_acquire)) == TRACE_PIPELINE_DEPTH ) {
+            if (stopping.load(std::memory_order_relaxed)) {
+                return;
+            }
+
+            std::this_thread::yield();
+        }
+
+        more = fill(ring[batchCount % TRACE_PIPELINE_DEPTH]);
+
+        if (!more) {
+            trailingIgnored = source->getTrailingIgnored(); //published along with the last batch
+        }
+
+        batchCount++;
+        produced.store(batchCount, std::memory_order_release);
+    }
+}
+
+bool PipelinedTraceReader::next(TraceRecord& record) {
+    while ( (current == nullptr) || (index == current->count) ) {
+        uint64_t batchCount = consumed.load(std::memory_order_relaxed);
+
+        if (current != nullptr) {
+            if (current->last) {
+                return false;
+            }
+
+            //hand the drained batch back to the producer
+            batchCount++;
+            consumed.store(batchCount, std::memory_order_release);
+        }
+
+        while (produced.load(std::memory_order_acquire) == batchCount) {
+            std::this_thread::yield();
+        }
+
+        current = &ring[batchCount % TRACE_PIPELINE_DEPTH];
+        index = 0;
+    }
+
+    record = current->records[index];
+    index++;
+    return true;
+}
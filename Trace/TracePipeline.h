@@ -0,0 +1,77 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef TracePipeline_h
+#define TracePipeline_h
+
+#include "TraceReader.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define TRACE_PIPELINE_BATCH_RECORDS 4096
+#define TRACE_PIPELINE_DEPTH 8 //number of batches in flight
+
+struct TraceBatch {
+    std::vector<TraceRecord> records;
+    size_t count;
+    bool last; //the source was exhausted after this batch
+};
+
+/**
+ * Parses the trace on a producer thread and hands fixed-size batches to the consumer over a single-producer/single-consumer ring;
+ * the record stream is exactly that of the source reader
+ */
+class PipelinedTraceReader : public TraceReader {
+private:
+    TraceReader* source;
+    TraceBatch ring[TRACE_PIPELINE_DEPTH];
+    std::atomic<uint64_t> produced; //batches published by the producer
+    std::atomic<uint64_t> consumed; //batches handed back by the consumer
+    std::atomic<bool> stopping;
+    std::thread producer;
+
+    //consumer side
+    TraceBatch* current;
+    size_t index;
+
+    /**
+     * Body of the producer thread
+     */
+    void produce();
+
+    /**
+     * Fill a batch from the source
+     * @return False if the source is exhausted
+     */
+    bool fill(TraceBatch& batch);
+
+public:
+    /**
+     * Constructor; starts the producer thread
+     * @param initSource The reader being wrapped; owned (and DELETEd) by this object
+     */
+    PipelinedTraceReader(TraceReader* initSource);
+
+    /**
+     * Destructor; stops the producer thread and DELETEs the source
+     */
+    ~PipelinedTraceReader();
+
+    /**
+     * Fetch the next record
+     * @return False if the trace is exhausted
+     */
+    bool next(TraceRecord& record);
+};
+
+#endif /* TracePipeline_h */
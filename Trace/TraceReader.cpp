@@ -0,0 +1,118 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+#include "TraceReader.h"
+#include "TextTrace.h"
+#include "BinaryTrace.h"
+#include "CompressedTrace.h"
+#include "RecordStream.h"
+#include "TracePipeline.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sys/stat.h>
+#include <thread>
+
+TraceReader::TraceReader(): leadingIgnored(0), trailingIgnored(0) {
+
+}
+
+TraceReader::~TraceReader() {
+
+}
+
+uint64_t TraceReader::getLeadingIgnored() const {
+    return leadingIgnored;
+}
+
+uint64_t TraceReader::getTrailingIgnored() const {
+    return trailingIgnored;
+}
+
+/**
+ * Open the reader of a stream, which cannot be memory-mapped
+ */
+static TraceReader* openTraceStream(FILE* stream) {
+    //streams cannot be rewound; peek at the first byte only
+    int first = getc(stream);
+    ungetc(first, stream);
+
+    if (first == (unsigned char) BINARY_TRACE_MAGIC[0]) {
+        return new BinaryTraceReader(stream);
+    }
+
+    if (first == (unsigned char) RECORD_STREAM_MAGIC[0]) {
+        return new RecordStreamReader(stream);
+    }
+
+    return new TextTraceReader(stream);
+}
+
+/**
+ * Open the reader that actually parses or decodes the trace
+ */
+static TraceReader* openTraceSource(const std::string& path) {
+    FILE* file = stdin;
+    unsigned char magic[BINARY_TRACE_MAGIC_SIZE];
+
+    if ( !path.empty() && (path != "-") ) {
+        file = fopen(path.c_str(), "rb");
+
+        if (file == nullptr) {
+            std::cout << "Specified File Cannot Be Opened\n";
+            exit(EXIT_FAILURE);
+        }
+
+        struct stat info;
+
+        if ( (fstat(fileno(file), &info) == 0) && S_ISREG(info.st_mode) ) {
+            size_t magicSize = fread(magic, 1, BINARY_TRACE_MAGIC_SIZE, file);
+            TraceCompression compression = detectCompression(magic, magicSize);
+
+            if (compression != TRACE_PLAIN) {
+                rewind(file);
+                return openTraceStream(openDecompressed(file, compression, nullptr, 0));
+            }
+
+            if ( (magicSize == BINARY_TRACE_MAGIC_SIZE) && (memcmp(magic, BINARY_TRACE_MAGIC, BINARY_TRACE_MAGIC_SIZE) == 0) ) {
+                rewind(file);
+                return new BinaryTraceReader(file);
+            }
+
+            fclose(file);
+            return new TextTraceReader(path);
+        }
+
+    }
+
+    //the magic number of a compressed stream has to be consumed; it is replayed if it turns out not to be one
+    int first = getc(file);
+    ungetc(first, file);
+
+    if (mayBeCompressed(first)) {
+        size_t magicSize = fread(magic, 1, COMPRESSED_TRACE_MAGIC_SIZE, file);
+        file = openDecompressed(file, detectCompression(magic, magicSize), magic, magicSize);
+    }
+
+    return openTraceStream(file);
+}
+
+TraceReader* openTrace(const std::string& path) {
+    TraceReader* source = openTraceSource(path);
+
+    //parsing overlaps simulation only if there is a spare core for it
+    if (std::thread::hardware_concurrency() > 1) {
+        return new PipelinedTraceReader(source);
+    }
+
+    return source;
+}
@@ -0,0 +1,60 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+#ifndef TraceReader_h
+#define TraceReader_h
+
+#include "TraceRecord.h"
+
+class TraceReader {
+protected:
+    uint64_t leadingIgnored;
+    uint64_t trailingIgnored;
+
+public:
+    /**
+     * Constructor
+     */
+    TraceReader();
+
+    /**
+     * Destructor; nothing to be done
+     */
+    virtual ~TraceReader();
+
+    /**
+     * Fetch the next record of the trace
+     * @return False if the trace is exhausted
+     */
+    virtual bool next(TraceRecord& record) = 0;
+
+    /**
+     * @return Number of lines ignored before the first record
+     */
+    uint64_t getLeadingIgnored() const;
+
+    /**
+     * @return Number of lines ignored after the last record; valid once next() returned false
+     */
+    uint64_t getTrailingIgnored() const;
+};
+
+/**
+ * Open a trace; binary traces are recognized by their magic number, anything else is parsed as text.
+ * Record streams (see RecordStream) are recognized on stdin as well.
+ * Gzip, zstd and xz compressed traces, recognized by their magic number as well, are decompressed on the fly.
+ * On machines with more than one core, parsing runs on its own thread (see PipelinedTraceReader)
+ * @param path Path of the trace; empty or "-" reads stdin
+ * @return The reader; DELETEing it is caller's responsibility
+ */
+TraceReader* openTrace(const std::string& path);
+
+#endif /* TraceReader_h */
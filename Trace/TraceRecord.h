@@ -8,52 +8,24 @@ Please cite the following paper when using the provided source codes:
 M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
 */
 
-#ifndef CacheBlock_h
-#define CacheBlock_h
-
-#include "Block.h"
-
-class CacheBlock: public Block {
-friend class CompleteCache;
-protected:
-    bool dirty;
-    CacheBlock* former;
-    
-public:
-    /**
-     * Constructor
-     * @param blockOffset Number of rightmost bits that should be ignored
-     */
-    CacheBlock(int blockOffset);
-    
-    /**
-     * Copy constructor
-     * @param src Source
-     */
-    CacheBlock(const CacheBlock& src);
-    
-    /**
-     * Destructor; delete former in case
-     */
-    virtual ~CacheBlock();
-    
-    /**
-     * Set isDirty to True
-     */
-    void setDirty();
-    
-    /**
-     * @return dirty
-     */
-    bool isDirty() const;
-    
-    /**
-     * @return Former data
-     */
-    const CacheBlock* set(lli newAddr, bool newDirty, std::string value);
-
-    void setVal(std::string value);
-};
 
+#ifndef TraceRecord_h
+#define TraceRecord_h
+
+#include "BlockValue.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * Access types found in the trace; the order mirrors AccessType of the Baseline and ICD driver
+ */
+enum TraceType {TRACE_READ, TRACE_WRITE, TRACE_FETCH, TRACE_EVICT_CLEAN, TRACE_EVICT_DIRTY, TRACE_EVICT_WRITABLE, TRACE_UPGRADE};
+
+struct TraceRecord {
+    uint64_t pc;
+    uint64_t addr;
+    TraceType type;
+    BlockValue value; //decoded from the rest of the line after the qualifier
+};
 
-#endif /* CacheBlock_h */
+#endif /* TraceRecord_h */
@@ -0,0 +1,42 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+#include <iostream>
+#include <cstdlib>
+#include "TraceReader.h"
+#include "BinaryTrace.h"
+
+using namespace std;
+
+int main(int argc, const char* argv[]) {
+
+    if (argc != 3) {
+        cout << "Runtime Argument Bad Format\n";
+        cout << "Usage: trace2bin <text trace | -> <binary trace>\n";
+        exit(EXIT_FAILURE);
+    }
+
+    TraceReader* in = openTrace(argv[1]);
+    BinaryTraceWriter out(argv[2]);
+    TraceRecord record;
+
+    while (in->next(record)) {
+        out.write(record);
+    }
+
+    out.close(in->getLeadingIgnored(), in->getTrailingIgnored());
+    cout << "RECORDS: \t" << out.getHeader().recordCount << endl;
+    cout << "CHUNKS: \t" << out.getHeader().chunkCount << endl;
+    cout << "(FIRST " << out.getHeader().leadingIgnored << " LINES WERE IGNORED)" << endl;
+    cout << "(LAST " << out.getHeader().trailingIgnored << " LINES WERE IGNORED)" << endl;
+    delete in;
+    return 0;
+}
@@ -10,6 +10,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 #include "Block.h"
 
+namespace wade {
+
 Block::Block(ll tag) : tag(tag) {
 	this->status = 0;
 }
@@ -22,3 +24,19 @@ bool Block::is_dirty() {
 		return true;
 	return false;
 }
+
+void Block::save(SnapshotWriter& snapshot) {
+	snapshot.put64(this->tag);
+	snapshot.put64(this->savedAddr);
+	snapshot.put8(this->status);
+	snapshot.putValue(this->value);
+}
+
+void Block::load(SnapshotReader& snapshot) {
+	this->tag = snapshot.get64();
+	this->savedAddr = snapshot.get64();
+	this->status = snapshot.get8();
+	snapshot.getValue(this->value);
+}
+
+} // namespace wade
@@ -12,6 +12,9 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #define BLOCK_H_
 
 #include "util.h"
+#include "BlockValue.h"
+
+namespace wade {
 
 #define BLOCK_VALID_BIT 1
 #define BLOCK_DIRTY_BIT 2
@@ -21,12 +24,16 @@ public:
     ll savedAddr;
 	ll tag;
 	byte status;	// valid bit
-	std::string value;
+	BlockValue value;
 
 	Block(ll tag = 0);
 	virtual ~Block();
 
 	bool is_dirty();
+	void save(SnapshotWriter& snapshot);
+	void load(SnapshotReader& snapshot);
 };
 
+} // namespace wade
+
 #endif /* BLOCK_H_ */
@@ -13,9 +13,11 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include <algorithm>
 #include <cstring>
 
+namespace wade {
+
 extern long double timer;
 extern long double clkStep;
-extern std::ofstream out;
+extern std::ofstream out; //the time trace; written only if open
 
 int Cache::sets_num = 0;
 int Cache::fwp_sets_num = 0;
@@ -84,7 +86,7 @@ Cache::~Cache() {
 	delete[] sets;
 }
 
-void Cache::lookup(ll mem_addr, AccessType type, std::string value) {
+void Cache::lookup(ll mem_addr, AccessType type, const BlockValue& value) {
 
 	ll index = mem_addr >> logarithm2(block_size);
 	index &= sets_num - 1;
@@ -104,14 +106,11 @@ void Cache::lookup(ll mem_addr, AccessType type, std::string value) {
 
 	bool res = sets[index]->lookup(tag, type, mem_addr, value);
 
-#ifdef GENERATE_TIME_TRACE
-    if (!res) {
+    if (out.is_open() && !res) { //time trace
         //if missed
         out << mem_addr << " R " << std::fixed << timer << " " << value << std::endl;
     }
 
-#endif
-
 	update_statistics(type, res);
 //	std::cerr << "!! " << index << "\n";
 	return;
@@ -140,3 +139,39 @@ MemAccess Cache::convert_set_access_to_fwp_access(MemAccess mem_access) {
 
 	return MemAccess(tag, index);
 }
+
+void Cache::save(SnapshotWriter& snapshot) {
+	snapshot.put32(Cache::total_reads);
+	snapshot.put32(Cache::read_hits);
+	snapshot.put64(Cache::total_accs);
+	snapshot.put64(Cache::accs_hits);
+	snapshot.put32(Cache::writebacks);
+	for(int i = 0; i < 10; i++)
+		snapshot.put32(Cache::segment_predictor_statistics.count[i]);
+	segment_predictor->save(snapshot);
+	for(int i = 0; i < 4 * rep_data->num_of_segment_set; i++)
+		sampler_sets[i]->save(snapshot);
+	for(int i = 0; i < sets_num; i++)
+		sets[i]->save(snapshot);
+	for(int i = 0; i < fwp_sets_num; i++)
+		fwp_sets[i]->save(snapshot);
+}
+
+void Cache::load(SnapshotReader& snapshot) {
+	Cache::total_reads = snapshot.get32();
+	Cache::read_hits = snapshot.get32();
+	Cache::total_accs = snapshot.get64();
+	Cache::accs_hits = snapshot.get64();
+	Cache::writebacks = snapshot.get32();
+	for(int i = 0; i < 10; i++)
+		Cache::segment_predictor_statistics.count[i] = snapshot.get32();
+	segment_predictor->load(snapshot);
+	for(int i = 0; i < 4 * rep_data->num_of_segment_set; i++)
+		sampler_sets[i]->load(snapshot);
+	for(int i = 0; i < sets_num; i++)
+		sets[i]->load(snapshot);
+	for(int i = 0; i < fwp_sets_num; i++)
+		fwp_sets[i]->load(snapshot);
+}
+
+} // namespace wade
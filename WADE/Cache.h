@@ -17,6 +17,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include "FWPSet.h"
 #include "SegmentPredictor.h"
 
+namespace wade {
+
 class SegmentPredictorStatistics {
 public:
 	SegmentPredictorStatistics() {
@@ -53,8 +55,14 @@ public:
 
 	Cache(int way, int block_size, int cache_size, RepData* rep_data);
 	virtual ~Cache();
-	void lookup(ll mem_addr, AccessType type, std::string value);
+	void lookup(ll mem_addr, AccessType type, const BlockValue& value);
 	static MemAccess convert_set_access_to_fwp_access(MemAccess mem_access);
+	// the statistics, the predictor and every set, sampler and FWP sets included
+	void save(SnapshotWriter& snapshot);
+	// the cache must be just constructed with the same geometry
+	void load(SnapshotReader& snapshot);
 };
 
+} // namespace wade
+
 #endif /* CACHE_H_ */
@@ -11,6 +11,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include "FWPEntry.h"
 #include "Cache.h"
 
+namespace wade {
+
 FWPEntry::FWPEntry(int tag, int set_index) : tag(tag) {
 	if(set_index < 0 || set_index >= 32) {
 		throw ("unknown fwp index for creating fwp entry");
@@ -42,3 +44,17 @@ bool FWPEntry::get_set_flag(int set_index) {
 int FWPEntry::get_victim_value(int lru_recency) {
 	return this->frequency_counter + Cache::rep_data->y * lru_recency;
 }
+
+void FWPEntry::save(SnapshotWriter& snapshot) {
+	snapshot.put32(this->flags);
+	snapshot.put32(this->tag);
+	snapshot.put32(this->frequency_counter);
+}
+
+void FWPEntry::load(SnapshotReader& snapshot) {
+	this->flags = snapshot.get32();
+	this->tag = snapshot.get32();
+	this->frequency_counter = snapshot.get32();
+}
+
+} // namespace wade
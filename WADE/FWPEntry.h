@@ -13,6 +13,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 #include "util.h"
 
+namespace wade {
+
 class FWPEntry {
 	uint32_t flags;
 public:
@@ -27,6 +29,10 @@ public:
 	bool get_set_flag(int set_index);
 
 	int get_victim_value(int lru_recency);
+	void save(SnapshotWriter& snapshot);
+	void load(SnapshotReader& snapshot);
 };
 
+} // namespace wade
+
 #endif /* SRC_FWPENTRY_H_ */
@@ -11,6 +11,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include "FWPSet.h"
 #include "Cache.h"
 
+namespace wade {
+
 FWPSet::FWPSet(int ways_num) : ways_num(ways_num) {
 
 }
@@ -72,3 +74,20 @@ int FWPSet::get_victim_index() {
 	}
 	return index;
 }
+
+void FWPSet::save(SnapshotWriter& snapshot) {
+	snapshot.put32(this->entries.size());
+	for(int i = 0; i < this->entries.size(); i++)
+		this->entries[i]->save(snapshot);
+}
+
+void FWPSet::load(SnapshotReader& snapshot) {
+	int entry_count = snapshot.get32();
+	for(int i = 0; i < entry_count; i++) {
+		FWPEntry* entry = new FWPEntry(0, 0);
+		entry->load(snapshot);
+		this->entries.push_back(entry);
+	}
+}
+
+} // namespace wade
@@ -14,6 +14,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include "FWPEntry.h"
 #include <vector>
 
+namespace wade {
+
 class FWPSet {
 	int ways_num;
 	std::vector<FWPEntry*> entries;
@@ -25,6 +27,11 @@ public:
 	void update(ll tag, int set_index);
 
 	int get_victim_index();
+	void save(SnapshotWriter& snapshot);
+	// the set must be empty
+	void load(SnapshotReader& snapshot);
 };
 
+} // namespace wade
+
 #endif /* FWPSET_H_ */
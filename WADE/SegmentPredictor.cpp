@@ -13,6 +13,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include <cmath>
 #include <cassert>
 
+namespace wade {
+
 SegmentPredictor::SegmentPredictor() {
 	for(int i = 0; i < 5; i++)
 		PSEL[i] = 0;
@@ -132,3 +134,17 @@ bool SegmentPredictor::is_p_double() {
 		return true;
 	return false;
 }
+
+void SegmentPredictor::save(SnapshotWriter& snapshot) {
+	for(int i = 0; i < 5; i++)
+		snapshot.put32(PSEL[i]);
+	snapshot.putRaw(&this->p, sizeof(this->p));
+}
+
+void SegmentPredictor::load(SnapshotReader& snapshot) {
+	for(int i = 0; i < 5; i++)
+		PSEL[i] = snapshot.get32();
+	snapshot.getRaw(&this->p, sizeof(this->p));
+}
+
+} // namespace wade
@@ -13,6 +13,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 #include "util.h"
 
+namespace wade {
+
 #define MAX_PSEL_VALUE ((1 << 11) - 1)
 #define MIN_PSEL_VALUE (-(1 << 11))
 
@@ -32,6 +34,10 @@ public:
 
 	void increment(int index, int value);
 	void decrement(int index, int value);
+	void save(SnapshotWriter& snapshot);
+	void load(SnapshotReader& snapshot);
 };
 
+} // namespace wade
+
 #endif /* SRC_SEGMENTPREDICTOR_H_ */
@@ -15,9 +15,11 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include <algorithm>
 #include <cstring>
 
+namespace wade {
+
 extern long double timer;
 extern long double clkStep;
-extern std::ofstream out;
+extern std::ofstream out; //the time trace; written only if open
 
 Set::Set(int ways_num, REP_POLICY* replacement_policy) :
 		ways_num(ways_num), replacement_policy(
@@ -51,7 +53,7 @@ void Set::add_to_list(Block* block) {
 //		std::cerr << "! 4\n";
 }
 
-bool Set::lookup(ll tag, AccessType type, ll savedAddr, std::string value) {
+bool Set::lookup(ll tag, AccessType type, ll savedAddr, const BlockValue& value) {
 //	if(index == 1806)
 //		std::cerr << "1\n";
 	for (int i = 0; i < this->frequent_blocks.size(); i++)
@@ -93,7 +95,7 @@ bool Set::lookup(ll tag, AccessType type, ll savedAddr, std::string value) {
 	return false;
 }
 
-void Set::add(ll tag, AccessType type, ll savedAddr, std::string value){
+void Set::add(ll tag, AccessType type, ll savedAddr, const BlockValue& value){
 	if(this->frequent_blocks.size() + this->nonfrequent_blocks.size() < this->ways_num) {
 //		std::cerr << "still not full\n";
 		Block* new_block = new Block(tag);
@@ -169,9 +171,9 @@ void Set::add(ll tag, AccessType type, ll savedAddr, std::string value){
 	if(*this->replacement_policy == REP_POLICY::FOLLOWER && evicted_block->is_dirty()) {
 		Cache::writebacks++;
 
-#ifdef GENERATE_TIME_TRACE
-        out << evicted_block->savedAddr << " W " << std::fixed << timer << " " << evicted_block->value << std::endl;
-#endif
+        if (out.is_open()) { //time trace
+            out << evicted_block->savedAddr << " W " << std::fixed << timer << " " << evicted_block->value << std::endl;
+        }
 
 		MemAccess fwp_address = Cache::convert_set_access_to_fwp_access(MemAccess(evicted_block->tag, index));
 //		std::cerr << std::hex << fwp_address.tag << " " << this->index << "\n" << std::dec;
@@ -187,3 +189,31 @@ void Set::add(ll tag, AccessType type, ll savedAddr, std::string value){
 		new_block->status |= BLOCK_DIRTY_BIT;
 	add_to_list(new_block);
 }
+
+void Set::save(SnapshotWriter& snapshot) {
+	snapshot.put8(this->even_write);
+	snapshot.put32(this->frequent_blocks.size());
+	for(int i = 0; i < this->frequent_blocks.size(); i++)
+		this->frequent_blocks[i]->save(snapshot);
+	snapshot.put32(this->nonfrequent_blocks.size());
+	for(int i = 0; i < this->nonfrequent_blocks.size(); i++)
+		this->nonfrequent_blocks[i]->save(snapshot);
+}
+
+void Set::load(SnapshotReader& snapshot) {
+	this->even_write = snapshot.get8();
+	int frequent_count = snapshot.get32();
+	for(int i = 0; i < frequent_count; i++) {
+		Block* block = new Block();
+		block->load(snapshot);
+		this->frequent_blocks.push_back(block);
+	}
+	int nonfrequent_count = snapshot.get32();
+	for(int i = 0; i < nonfrequent_count; i++) {
+		Block* block = new Block();
+		block->load(snapshot);
+		this->nonfrequent_blocks.push_back(block);
+	}
+}
+
+} // namespace wade
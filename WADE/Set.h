@@ -17,6 +17,8 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include <queue>
 #include <vector>
 
+namespace wade {
+
 class Set {
 	int ways_num;
 	std::vector<Block*> frequent_blocks;
@@ -32,8 +34,13 @@ public:
 	int index;
 
 	void add_to_list(Block* block);
-	bool lookup(ll tag, AccessType type, ll savedAddr, std::string value);
-	void add(ll tag, AccessType type, ll savedAddr, std::string value);
+	bool lookup(ll tag, AccessType type, ll savedAddr, const BlockValue& value);
+	void add(ll tag, AccessType type, ll savedAddr, const BlockValue& value);
+	void save(SnapshotWriter& snapshot);
+	// the set must be empty
+	void load(SnapshotReader& snapshot);
 };
 
+} // namespace wade
+
 #endif /* SET_H_ */
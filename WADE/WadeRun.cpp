@@ -0,0 +1,189 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#include <iostream>
+#include <cstdio>
+#include <fstream>
+
+#include "util.h"
+#include <cstdlib>
+#include <cstring>
+#include "Cache.h"
+#include "TraceReader.h"
+#include "TimeSampler.h"
+#include "WadeRun.h"
+
+using namespace std;
+
+namespace wade {
+
+long double timer;
+long double clkStep;
+ofstream out;
+
+// the words of each access type in a text trace, indexed by AccessType; printed by the progress lines
+static const char* access_type_names[] = {"", "Read (none)", "Write (none)", "Fetch (none)", "Upgrade (none)",
+		"Eviction (clean)", "Eviction (dirty)", "Eviction (writable)"};
+
+AccessType get_access_type(TraceType type) {
+	switch(type) {
+	case TRACE_READ:
+		return AccessType::READ_REQ;
+	case TRACE_WRITE:
+		return AccessType::WRITE_REQ;
+	case TRACE_FETCH:
+		return AccessType::FETCH_REQ;
+	case TRACE_EVICT_CLEAN:
+		return AccessType::EVICTION_CLEAN;
+	case TRACE_EVICT_DIRTY:
+		return AccessType::EVICTION_DIRTY;
+	case TRACE_EVICT_WRITABLE:
+		return AccessType::EVICTION_WRITABLE;
+	case TRACE_UPGRADE:
+		return AccessType::UPGRADE_REQ;
+	default:
+		std::cerr << int(type) << "\n";
+		throw ("invalid access type");
+	}
+}
+
+// saves the cache and the time trace clock to config.checkpointPath
+static void save_state(Cache* cache, const RunConfig& config, int total) {
+	SnapshotWriter snapshot(config.checkpointPath, config, total);
+	snapshot.putRaw(&timer, sizeof(timer));
+	cache->save(snapshot);
+	snapshot.close();
+}
+
+// loads them back and skips the queries already simulated; returns their number
+static int restore_state(Cache* cache, const RunConfig& config, TraceReader* trace) {
+	SnapshotReader snapshot(config.restorePath, config);
+	snapshot.getRaw(&timer, sizeof(timer));
+	cache->load(snapshot);
+	snapshot.close();
+	skipQueries(trace, snapshot.getQueryOffset());
+	return snapshot.getQueryOffset();
+}
+
+} // namespace wade
+
+using namespace wade;
+
+int runWade(const RunConfig& config) {
+	srand(0);
+
+	RepData rep_data;
+    rep_data.seed = 1;
+    rep_data.num_of_segment_set = 16;
+    rep_data.l = 1;
+
+	if(!config.timeTracePath.empty()) {
+		clkStep = config.clkStep;
+		out.open(config.timeTracePath);
+
+		if (!out.is_open()) {
+			cout << "Specified File Cannot Be Opened\n";
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	Cache* cache = new Cache(config.associativity, config.blockBytes, config.cacheKiB * (1<<10), &rep_data);
+	TraceReader* trace = openTrace(config.traceSource());
+	TraceRecord record;
+    long long unsigned pc; 
+	ll mem_addr;
+	int total = 0;
+
+	if(!config.restorePath.empty())
+		total = restore_state(cache, config, trace);
+
+	// time sampling warms the cache up between its windows with lookups that carry no value; the predictors and the
+	// sampler sets learn from every access, so there is no cheaper path to warm them
+	TimeSampler* sampler = nullptr;
+	BlockValue no_value;
+	if(config.sampleLength != 0) {
+		if(out.is_open() || !config.checkpointPath.empty() || !config.restorePath.empty()) {
+			cout << "Time Sampling Cannot Be Combined With The Time Trace Or Snapshots\n";
+			exit(EXIT_FAILURE);
+		}
+		sampler = new TimeSampler(config);
+	}
+
+	while(trace->next(record)) {
+		pc = record.pc;
+		mem_addr = record.addr;
+		AccessType type = get_access_type(record.type);
+		if(type == AccessType::UPGRADE_REQ)
+			continue;
+		if(total == 0) {
+			std::cerr << "-------------------- ";
+			std::cerr << "end of warmup --------------------\n";
+			Cache::writebacks = 0;
+			Cache::read_hits = 0;
+			Cache::total_reads = 0;
+            Cache::total_accs = 0;
+            Cache::accs_hits = 0;
+			for(int i = 1; i <= 6; i++)
+				Cache::segment_predictor_statistics.count[i] = 0;
+		}
+		if(total % (1000*1000) == 0) {
+			std::cerr << total / 1000000 << "\t" << pc << "\t" << mem_addr << "\t" << access_type_names[type] << "\n";
+			for(int i = 1; i <= 3; i++)
+				std::cerr << cache->segment_predictor->PSEL[i] << " ";
+			std::cerr << cache->segment_predictor->get_predicted_dynamic_segment_size() << "\t"
+					<< cache->segment_predictor->get_predicted_frequent_size() << "\n";
+		}
+        total++; 
+		if(sampler == nullptr || sampler->detailed())
+			cache->lookup(mem_addr, type, record.value);
+		else
+			cache->lookup(mem_addr, type, no_value);
+
+        if ( out.is_open() && ((type == AccessType::READ_REQ) || (type == AccessType::WRITE_REQ)) ) {
+            timer += clkStep;
+        }
+
+		if(config.checkpointEvery != 0 && total % config.checkpointEvery == 0)
+			save_state(cache, config, total);
+
+		if(sampler != nullptr) {
+			sampler->advance(Cache::writebacks, Cache::read_hits, Cache::total_reads);
+			if(sampler->done())
+				break;
+		}
+	}
+	if(!config.checkpointPath.empty())
+		save_state(cache, config, total);
+	delete(trace);
+	double read_hit_ratio = double(Cache::read_hits)/double(Cache::total_reads);
+    double total_hit_ratio = double(Cache::accs_hits)/double(Cache::total_accs);
+	std::cout << "read_hits : " << Cache::read_hits << "\n";
+	std::cout << "total_reads : " << Cache::total_reads << "\n";
+	std::cout << "read_hit_ratio : " << read_hit_ratio << "\n";
+    std::cout << "number of writebacks : " << Cache::writebacks << "\n";
+    
+    std::cout << "accs_hits : " << Cache::accs_hits << "\n";
+    std::cout << "total_accs : " << Cache::total_accs << "\n";
+    std::cout << "total_hit_ratio : " << total_hit_ratio << "\n";
+    
+	std::cout << "total accesses : " << total << "\n";
+	for(int i = 1; i <= 6; i++)
+		std::cout << Cache::segment_predictor_statistics.count[i] << "\t";
+	std::cout << "\n";
+	if(sampler != nullptr) {
+		sampler->print(std::cout);
+		delete(sampler);
+	}
+
+	delete(cache);
+	return 0;
+}
@@ -0,0 +1,25 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef WADE_RUN_H_
+#define WADE_RUN_H_
+
+#include "RunConfig.h"
+
+#define WADE_VERSION "WADE v0.9" //bump it when the results of the model change
+
+/*
+ * Simulate WADE on a trace and print the statistics; config.timeTracePath enables the time trace
+ */
+int runWade(const RunConfig& config);
+
+#endif /* WADE_RUN_H_ */
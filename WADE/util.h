@@ -15,6 +15,9 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include <cstdint>
 #include <cstdlib>
 #include <fstream>
+#include "Snapshot.h"
+
+namespace wade {
 
 typedef long long ll;
 typedef uint8_t byte;
@@ -86,4 +89,6 @@ public:
 	double l;
 };
 
+} // namespace wade
+
 #endif /* UTIL_H_ */
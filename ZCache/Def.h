@@ -13,6 +13,7 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 
 #include <vector>
 #include <algorithm>
+#include "Snapshot.h"
 
 #define SIZE 512 //KB
 #define ASSOCIATIVITY 4
@@ -21,6 +22,9 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #define LOG_EVERY_QUERY_COUNT 100000
 #define DEPTH 3
 #define K_CONST 410
+#define PREFETCH_DISTANCE 8
+
+namespace zcache {
 
 typedef long int lli;
 
@@ -29,4 +33,6 @@ struct BitLen {
     int sets;
 };
 
+} // namespace zcache
+
 #endif /* Def_h */
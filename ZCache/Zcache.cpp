@@ -13,12 +13,7 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #include <cmath>
 #include <iostream>
 
-Block::Block(lli lastAccess) {
-    this->blockAddr = 0;
-    this->lastAccess = lastAccess;
-    this->isValid = false;
-    this->dirty = false;
-}
+namespace zcache {
 
 Node::Node(int index, int way, Node *parent) {
     this->index = index;
@@ -26,20 +21,9 @@ Node::Node(int index, int way, Node *parent) {
     this->way = way;
 }
 
-Zcache::Zcache(int size, int associativity) {
+Zcache::Zcache(int size, int associativity, int blockSize): content((lli) size * 1024 / blockSize) {
     this->associativity = associativity;
-    this->setCount = (size * 1024) / associativity / 64;
-    
-    for (int i = 0; i < associativity; i++) {
-        vector<Block> copyVec;
-        this->content.push_back(copyVec);
-        
-        for (int j = 0; j < setCount; j++) {
-            Block copyBlock(LONG_MIN + this->setCount * i + j);
-            this->content.at(i).push_back(copyBlock);
-        }
-        
-    }
+    this->setCount = (int) (((lli) size * 1024) / associativity / blockSize);
     
     this->hitCount = 0;
     this->missCount = 0;
@@ -49,10 +33,25 @@ Zcache::Zcache(int size, int associativity) {
     this->queryCounter = 0;
     this->tabas_globalCounter = 0;
     
-    this->bitLen.block = log2(BLOCK_SIZE);
+    this->bitLen.block = log2(blockSize);
     this->bitLen.sets = log2(this->setCount);
 }
 
+Block& Zcache::row(int way, int index) {
+    Block& block = this->content[(lli) way * this->setCount + index];
+    
+    if (!block.touched) {
+        block.lastAccess = initialAccess(way, index);
+        block.touched = true;
+    }
+    
+    return block;
+}
+
+lli Zcache::initialAccess(int way, int index) const {
+    return LONG_MIN + this->setCount * way + index;
+}
+
 void Zcache::lookup(lli addr, bool isDirty, bool affectRead) {
     Node *victimNode, *victimParentNode;
     Block *victimBlock, *victimParentBlock, *hitCandidate;
@@ -71,7 +70,7 @@ void Zcache::lookup(lli addr, bool isDirty, bool affectRead) {
     
     for (int i = 0; i < this->associativity; i++) {
         index = (int) skew(blockAddr, i);
-        hitCandidate = &this->content.at(i).at(index);
+        hitCandidate = &row(i, index);
         
         if ( (hitCandidate->blockAddr == blockAddr) && (hitCandidate->isValid) ) {
             hitCandidate->lastAccess = this->tabas_globalCounter;
@@ -97,8 +96,8 @@ void Zcache::lookup(lli addr, bool isDirty, bool affectRead) {
     while (victimNode->parent != NULL) {
         victimParentNode = victimNode->parent;
         
-        victimBlock = &this->content.at(victimNode->way).at(victimNode->index);
-        victimParentBlock = &this->content.at(victimParentNode->way).at(victimParentNode->index);
+        victimBlock = &row(victimNode->way, victimNode->index);
+        victimParentBlock = &row(victimParentNode->way, victimParentNode->index);
         
         victimBlock->blockAddr = victimParentBlock->blockAddr;
         victimBlock->lastAccess = victimParentBlock->lastAccess;
@@ -108,7 +107,7 @@ void Zcache::lookup(lli addr, bool isDirty, bool affectRead) {
         victimNode = victimParentNode;
     }
     
-    victimBlock = &this->content.at(victimNode->way).at(victimNode->index);
+    victimBlock = &row(victimNode->way, victimNode->index);
     
     if (victimBlock->dirty) {
         this->writebackCount++;
@@ -129,6 +128,15 @@ void Zcache::lookup(lli addr, bool isDirty, bool affectRead) {
     this->missCount++;
 }
 
+void Zcache::prefetch(lli addr) {
+    lli blockAddr = addr >> bitLen.block;
+    
+    for (int i = 0; i < this->associativity; i++) {
+        __builtin_prefetch(&this->content[(lli) i * this->setCount + skew(blockAddr, i)], 1);
+    }
+    
+}
+
 void Zcache::track(lli addr, int lvl, int way, Node *parent) {
     Block *victimCandidate;
     int row;
@@ -145,7 +153,7 @@ void Zcache::track(lli addr, int lvl, int way, Node *parent) {
         }
         
         row = (int) skew(addr, w);
-        victimCandidate = &this->content.at(w).at(row);
+        victimCandidate = &this->row(w, row);
         
         auto search = lateAccessed.find(victimCandidate->lastAccess);
        
@@ -193,6 +201,54 @@ long Zcache::skew(long blockAddr, long way) {
 
 }
 
+void Zcache::save(SnapshotWriter& snapshot) const {
+    snapshot.put64(this->hitCount);
+    snapshot.put64(this->missCount);
+    snapshot.put64(this->readCount);
+    snapshot.put64(this->readHitCount);
+    snapshot.put64(this->writebackCount);
+    snapshot.put64(this->queryCounter);
+    snapshot.put64(this->tabas_globalCounter);
+    
+    //the invalid blocks are written too, as their distinct last accesses order the first replacements
+    for (int i = 0; i < this->associativity; i++) {
+        
+        for (int j = 0; j < this->setCount; j++) {
+            const Block& block = this->content[(lli) i * this->setCount + j];
+            snapshot.put64(block.blockAddr);
+            snapshot.put64(block.touched ? block.lastAccess : initialAccess(i, j));
+            snapshot.put8((block.isValid ? 1 : 0) | (block.dirty ? 2 : 0));
+        }
+        
+    }
+    
+}
+
+void Zcache::load(SnapshotReader& snapshot) {
+    this->hitCount = snapshot.get64();
+    this->missCount = snapshot.get64();
+    this->readCount = snapshot.get64();
+    this->readHitCount = snapshot.get64();
+    this->writebackCount = snapshot.get64();
+    this->queryCounter = snapshot.get64();
+    this->tabas_globalCounter = snapshot.get64();
+    
+    for (int i = 0; i < this->associativity; i++) {
+        
+        for (int j = 0; j < this->setCount; j++) {
+            Block& block = this->content[(lli) i * this->setCount + j];
+            block.blockAddr = snapshot.get64();
+            block.lastAccess = snapshot.get64();
+            int flags = snapshot.get8();
+            block.isValid = ((flags & 1) != 0);
+            block.dirty = ((flags & 2) != 0);
+            block.touched = true;
+        }
+        
+    }
+    
+}
+
 // long Zcache::skew(lli addr, long way) {
 //     uint64_t blockAddr;
 //
@@ -210,4 +266,6 @@ long Zcache::skew(long blockAddr, long way) {
 //     blockAddr ^= (blockAddr >> 12);
 //
 //     return (blockAddr % this->setCount);
-// }
\ No newline at end of file
+// }
+
+} // namespace zcache
@@ -12,18 +12,21 @@ M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and
 #define Zcache_h
 
 #include "Def.h"
+#include "LazyArray.h"
 #include <set>
 #include <map>
 
 using namespace std;
 
+namespace zcache {
+
+/* a row is all zero until first touched; its distinct initial last access is derived then (see Zcache::row) */
 struct Block {
     lli blockAddr;
     lli lastAccess;
     bool isValid;
     bool dirty;
-
-    Block(lli lastAccess);
+    bool touched;
 };
 
 struct Node {
@@ -78,7 +81,7 @@ struct ElementCMP {
 };
 
 struct Zcache {
-    vector<vector<Block>> content;
+    LazyArray<Block> content; //the row of a way at [way * setCount + row]
     lli hitCount;
     lli missCount;
     lli readCount;
@@ -95,13 +98,25 @@ struct Zcache {
     map<lli, Node *> lateAccessed;
     vector<Node *> garbageCan;
     
-    Zcache(int size, int associativity);
+    Zcache(int size, int associativity, int blockSize);
+    /* the block in a row of a way, given its initial last access on first touch */
+    Block& row(int way, int index);
+    /* the last access a row starts with; distinct for every row so that the first replacements are ordered */
+    lli initialAccess(int way, int index) const;
     void lookup(lli blockAddr, bool isDirty, bool affectRead);
+    /* start loading the candidate rows of an upcoming lookup into the host cache */
+    void prefetch(lli addr);
     void track(lli addr, int lvl, int way, Node *parent);
     long H(long key);
     long H_inv(long key);
     long skew(lli blockAddr, long way);
     // unsigned int skew(int64_t addr, unsigned int way);
+    /* writes the statistics and every block to a snapshot */
+    void save(SnapshotWriter& snapshot) const;
+    /* reads them back into a cache just constructed with the same geometry */
+    void load(SnapshotReader& snapshot);
 };
 
+} // namespace zcache
+
 #endif /* Zcache_h */
\ No newline at end of file
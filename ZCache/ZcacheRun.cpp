@@ -0,0 +1,199 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+#include "ZcacheRun.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include "Zcache.h"
+#include <cassert>
+#include "TraceReader.h"
+
+#define LINE_WIDTH 48
+#define PRINT_VERSION cout << ZCACHE_VERSION << endl
+#define PRINT_MULT(char, count) (cout << setfill(char) << setw(count) << "")
+
+using namespace std;
+using namespace zcache;
+
+static time_t start;
+static lli ignoreEnd;
+static Zcache *cache;
+static TraceReader* trace;
+
+static void calculateRange();
+static void postReport();
+static void preReport(const RunConfig& config);
+
+/*
+ * reads the next query of the trace; returns false if the trace is exhausted
+ */
+static inline bool nextQuery(TraceRecord& record) {
+
+    while (trace->next(record)) {
+
+        if (record.type != TRACE_UPGRADE) { //ignore Upgrade
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * saves the cache to config.checkpointPath
+ */
+static void saveState(const RunConfig& config) {
+    SnapshotWriter snapshot(config.checkpointPath, config, cache->queryCounter);
+    cache->save(snapshot);
+    snapshot.close();
+}
+
+/*
+ * loads the cache from config.restorePath and skips the queries already simulated
+ */
+static void restoreState(const RunConfig& config) {
+    SnapshotReader snapshot(config.restorePath, config);
+    cache->load(snapshot);
+    snapshot.close();
+    skipQueries(trace, snapshot.getQueryOffset());
+}
+
+int runZcache(const RunConfig& config) {
+    //the trace is read from config.tracePath if given, and from stdin otherwise or when a sweep streams it there
+    trace = openTrace(config.traceSource());
+    preReport(config);
+    calculateRange();
+    start = time(NULL);
+
+    //initialize cache object
+    PRINT_MULT('-', LINE_WIDTH / 2 - 7);
+    cout << " BUCKETED LRU ";
+    PRINT_MULT('-', LINE_WIDTH / 2 - 7);
+    cout << endl;
+    cache = new Zcache(config.cacheKiB, config.associativity, config.blockBytes);
+
+    if (!config.restorePath.empty()) {
+        restoreState(config);
+    }
+
+    //FORMAT: %d   %d   %s   %s   %s
+    lli histo = cache->queryCounter - (cache->queryCounter % LOG_EVERY_QUERY_COUNT); //a restored run reports where it stopped
+    //the queries are read PREFETCH_DISTANCE ahead so that their rows are loaded while the earlier ones are looked up
+    TraceRecord window[PREFETCH_DISTANCE];
+    lli readCount = 0;
+    bool more = true;
+
+    //an exhausted trace is not read again, as that would reset its count of ignored lines
+    while ( (readCount < PREFETCH_DISTANCE) && (more = nextQuery(window[readCount])) ) {
+        cache->prefetch(window[readCount].addr);
+        readCount++;
+    }
+
+    for (lli sent = 0; sent < readCount; sent++) {
+        const TraceRecord& record = window[sent % PREFETCH_DISTANCE];
+        lli inp = record.addr;
+
+        //send query
+        bool isDirty = (record.type == TRACE_EVICT_DIRTY);
+        bool affectReadHitRatio = ((record.type == TRACE_READ) || (record.type == TRACE_WRITE) || (record.type == TRACE_FETCH));
+        cache->lookup(inp, isDirty, affectReadHitRatio);
+        
+        if (cache->queryCounter - histo >= LOG_EVERY_QUERY_COUNT) {
+            cout << setfill(' ') << "QUERY NO " << setw(10) << cache->queryCounter << " FINISHED! ";
+            cout.flush();
+            cout << "\n";
+            histo = cache->queryCounter;
+        }
+
+        if ( (config.checkpointEvery != 0) && (cache->queryCounter % config.checkpointEvery == 0) ) {
+            saveState(config);
+        }
+
+        if ( more && (more = nextQuery(window[readCount % PREFETCH_DISTANCE])) ) {
+            cache->prefetch(window[readCount % PREFETCH_DISTANCE].addr);
+            readCount++;
+        }
+    }
+    
+    if (!config.checkpointPath.empty()) {
+        saveState(config);
+    }
+    
+    ignoreEnd = trace->getTrailingIgnored();
+    delete trace;
+    
+    cout << "(LAST " << ignoreEnd << " LINES WERE IGNORED)" << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl << endl;
+
+    //print results
+    postReport();
+    return 0;
+}
+
+static void preReport(const RunConfig& config) {
+    PRINT_VERSION;
+    PRINT_MULT('=', LINE_WIDTH - 9);
+    cout << "CONSTANTS";
+    cout << endl;
+    cout << "Cache Size = \t\t" << config.cacheKiB << " (KiB)\n";
+    PRINT_MULT('_', LINE_WIDTH);
+    cout << endl;
+    cout << "Associativity = \t" << config.associativity << endl;
+    PRINT_MULT('_', LINE_WIDTH);
+    cout << endl;
+    cout << "Block Size = \t\t" << config.blockBytes << " (B)\n";
+    PRINT_MULT('_', LINE_WIDTH);
+    cout << endl;
+    cout << "Depth = \t\t" << DEPTH << endl;
+    PRINT_MULT('_', LINE_WIDTH);
+    cout << endl;
+    cout << "K_const = \t\t" << K_CONST << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl;
+}
+
+static void postReport() {
+    lli hits, misses, reads, readHits, writebacks;
+    hits = cache->hitCount;
+    misses = cache->missCount;
+    reads = cache->readCount;
+    readHits = cache->readHitCount;
+    writebacks = cache->writebackCount;
+    
+    PRINT_MULT('=', LINE_WIDTH - 7);
+    cout << "RESULTS\n";
+    PRINT_MULT('_', LINE_WIDTH - 7 - 8);
+    cout << endl;
+    cout << "MISS RATE: \t\t" << fixed << setprecision(5) << 1.0 * misses / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * misses / (hits + misses) << "%" << endl;
+    cout << "HIT RATE: \t\t" << fixed << setprecision(5) << 1.0 * hits / (hits + misses) << "\t";
+    cout << fixed << setprecision(3) << 100.0 * hits / (hits + misses) << "%" <<  endl;
+    cout << "READ HIT COUNT: \t\t" << fixed << setprecision(5) << readHits << endl;
+    cout << "TOTAL READ ACCESS COUNT: \t\t" << reads << endl;
+    cout << "READ HIT RATIO: \t\t" << fixed << setprecision(5) << 1.0 * readHits / reads << endl;
+    cout << "WRITE BACK COUNT: \t" << writebacks << endl;
+    cout << "TOTAL QUERIES: \t" << hits + misses << endl;
+    PRINT_MULT('_', LINE_WIDTH - 7);
+    cout << endl;
+    
+    time_t end = time(NULL);
+    time_t total = end - start;
+    cout << "TOTAL TIME: \t\t" << setfill('0') << setw(2) << total / 3600 << ":" << setw(2) << (total % 3600) / 60 << ":" << setw(2) << (total % 60) << endl;
+    PRINT_MULT('=', LINE_WIDTH);
+    cout << endl;
+}
+
+static void calculateRange() {
+    cout << "(FIRST " << trace->getLeadingIgnored() << " LINES WERE IGNORED)" << endl;
+}
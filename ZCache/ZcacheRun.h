@@ -0,0 +1,25 @@
+/*
+The source code of "Reducing Writebacks Through In-Cache Displacement" paper, which is accepted in ACM TODAES 2019.
+
+In this repo, we provide the source codes that are used in our ACM TODAES 2019 paper. This includes the implementation of our proposal, named ICD, as well as the implementation of competitor methods like WADE and HAP. We also provide the source code which acts as an interface between our simulator and Simics. This so-called Simics Interface extends the interface of Flexus simulator with Simics and gets the value of memory accesses, into the bargain.
+
+Please cite the following paper when using the provided source codes:
+
+M. Bakhshalipour, A. Faraji, A. Vakil-Ghahani, F. Samandi, P. Lotfi-Kamran, and H. Sarbazi-Azad, "Reducing Writebacks Through In-Cache Displacement," in ACM Transactions on Design Automation of Electronic Systems (TODAES), 2019.
+*/
+
+
+
+#ifndef ZcacheRun_h
+#define ZcacheRun_h
+
+#include "RunConfig.h"
+
+#define ZCACHE_VERSION "ZCache v0.9" //printed in the report; bump it when the results of the model change
+
+/*
+ * simulates the bucketed LRU zcache on a trace and prints the report
+ */
+int runZcache(const RunConfig& config);
+
+#endif /* ZcacheRun_h */